@@ -0,0 +1,553 @@
+/*
+ * Copyright 2022 Paolo Tassotti
+ *
+ * This file is part of Primality.
+ *
+ * Primality is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU General Public License as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * Primality is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with Primality.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * checkpoint.c: save and resume a long proof, see checkpoint.h
+ */
+
+/* Includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "checkpoint.h"
+
+
+/* private functions */
+
+/*
+ * write_ui(), read_ui(): unsigned integers of the given bytes, big endian
+ *
+ * return: 0 on success, -1 otherwise
+ */
+static int write_ui(FILE *file, unsigned long x, unsigned int bytes)
+{
+	unsigned char buf[8];
+	unsigned int i;
+
+	for (i = 0; i < bytes; i++) {
+		buf[bytes - 1 - i] = (unsigned char) (x >> (8 * i));
+	}
+
+	return (fwrite(buf, 1, bytes, file) == bytes) ? 0 : -1;
+}
+
+static int read_ui(FILE *file, unsigned long *x, unsigned int bytes)
+{
+	unsigned char buf[8];
+	unsigned int i;
+
+	if (fread(buf, 1, bytes, file) != bytes) { return -1; }
+
+	for (*x = 0, i = 0; i < bytes; i++) {
+		*x = (*x << 8) | buf[i];
+	}
+
+	return 0;
+}
+
+
+/*
+ * write_cmatrix(), read_cmatrix(): the coordinates of q12 and q22
+ *
+ * return: 0 on success, -1 otherwise
+ */
+static int write_cmatrix(FILE *file, struct cmatrix *matrix)
+{
+	unsigned int k;
+
+	for (k = 0; k < matrix->size; k++) {
+		if (mpz_out_raw(file, matrix->q12.values[k]) == 0) { return -1; }
+		if (mpz_out_raw(file, matrix->q22.values[k]) == 0) { return -1; }
+	}
+
+	return 0;
+}
+
+static int read_cmatrix(FILE *file, struct cmatrix *matrix)
+{
+	unsigned int k;
+
+	for (k = 0; k < matrix->size; k++) {
+		if (mpz_inp_raw(matrix->q12.values[k], file) == 0) { return -1; }
+		if (mpz_inp_raw(matrix->q22.values[k], file) == 0) { return -1; }
+	}
+
+	return 0;
+}
+
+
+/*
+ * write_factors(), read_factors(): a count and the factors, at most max of them read
+ *
+ * return: 0 on success, -1 otherwise
+ */
+static int write_factors(FILE *file, mpz_t *factors, unsigned int count)
+{
+	unsigned int i;
+
+	if ( write_ui(file, count, 4) ) { return -1; }
+
+	for (i = 0; i < count; i++) {
+		if (mpz_out_raw(file, factors[i]) == 0) { return -1; }
+	}
+
+	return 0;
+}
+
+static int read_factors(FILE *file, mpz_t **factors, unsigned int *count, size_t max)
+{
+	unsigned long x;
+
+	if (read_ui(file, &x, 4) || x > max) { return -1; }
+	if (x == 0) { return 0; }
+
+	*factors = malloc(x * sizeof(mpz_t));
+	if ( !*factors ) { return -1; }
+
+	for (*count = 0; *count < x; (*count)++) {
+
+		mpz_init((*factors)[*count]);
+
+		if (mpz_inp_raw((*factors)[*count], file) == 0) {
+			(*count)++;
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+
+/*
+ * copy_factors(): copy count factors to *factors, freed by clear_factors()
+ *
+ * return: 0 on success, -1 otherwise
+ */
+static int copy_factors(mpz_t **factors, unsigned int *count, mpz_t *from, unsigned int n)
+{
+	if (n == 0) { return 0; }
+
+	*factors = malloc(n * sizeof(mpz_t));
+	if ( !*factors ) { return -1; }
+
+	for (*count = 0; *count < n; (*count)++) {
+		mpz_init_set((*factors)[*count], from[*count]);
+	}
+
+	return 0;
+}
+
+static void clear_factors(mpz_t **factors, unsigned int *count)
+{
+	unsigned int i;
+
+	for (i = 0; i < *count; i++) {
+		mpz_clear((*factors)[i]);
+	}
+
+	free(*factors);
+	*factors = NULL;
+	*count = 0;
+}
+
+
+/*
+ * same_factors(): the two lists hold the same factors in the same order
+ */
+static int same_factors(mpz_t *a, unsigned int count_a, mpz_t *b, unsigned int count_b)
+{
+	unsigned int i;
+
+	if (count_a != count_b) { return 0; }
+
+	for (i = 0; i < count_a; i++) {
+		if (mpz_cmp(a[i], b[i]) != 0) { return 0; }
+	}
+
+	return 1;
+}
+
+
+/*
+ * elapsed(): the interval since the last save is over
+ */
+static int elapsed(struct checkpoint *ckpt)
+{
+	return difftime(time(NULL), ckpt->last) >= ckpt->interval;
+}
+
+
+/* public functions */
+
+/*
+ * checkpoint_init(): save to path every interval seconds
+ *
+ * return: 0 on success, -1 otherwise
+ */
+int checkpoint_init(struct checkpoint *ckpt, const char *path, unsigned int interval)
+{
+	/* sanity check */
+	if (!ckpt || !path) return -1;
+
+	ckpt->path = malloc(strlen(path) + 1);
+	if ( !ckpt->path ) { return -1; }
+
+	strcpy(ckpt->path, path);
+
+	ckpt->interval = interval;
+	ckpt->last = time(NULL);
+
+	mpz_init(ckpt->N);
+	ckpt->options = 0;
+	ckpt->started = 0;
+
+	ckpt->count_minus = 0;
+	ckpt->count_plus = 0;
+	ckpt->minus = NULL;
+	ckpt->plus = NULL;
+
+	ckpt->count = 0;
+	ckpt->alloc = 0;
+	ckpt->passed = NULL;
+
+	ckpt->l = 0;
+	ckpt->stage = 0;
+
+	ckpt->pending = 0;
+
+	return 0;
+}
+
+
+int checkpoint_free(struct checkpoint *ckpt)
+{
+	/* sanity check */
+	if (!ckpt) return -1;
+
+	if ( ckpt->pending ) {
+		cmatrix_free(&(ckpt->acc));
+		cmatrix_free(&(ckpt->power));
+		cmatrix_free(&(ckpt->base));
+		ckpt->pending = 0;
+	}
+
+	mpz_clear(ckpt->N);
+	clear_factors(&(ckpt->minus), &(ckpt->count_minus));
+	clear_factors(&(ckpt->plus), &(ckpt->count_plus));
+	free(ckpt->passed);
+	free(ckpt->path);
+
+	return 0;
+}
+
+
+/*
+ * checkpoint_load(): read the checkpoint file, N, the known factors and the options of
+ * the proof are set and the exponentiation in progress is pending for checkpoint_restore()
+ *
+ * return: 0 on success, -1 if the file is missing, truncated or of another version
+ */
+int checkpoint_load(struct checkpoint *ckpt)
+{
+	/* sanity check */
+	if (!ckpt || ckpt->started) return -1;
+
+	char magic[sizeof(CHECKPOINT_MAGIC) - 1];
+	unsigned long x, l, stage, bit, ring, size;
+	unsigned int i;
+	FILE *file;
+
+	file = fopen(ckpt->path, "rb");
+	if ( !file ) { return -1; }
+
+	if (fread(magic, 1, sizeof(magic), file) != sizeof(magic) ||
+			memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) != 0) { goto fail; }
+
+	if (read_ui(file, &x, 4) || x != CHECKPOINT_VERSION) { goto fail; }
+
+	if ( read_ui(file, &x, 4) ) { goto fail; }
+	ckpt->options = x;
+
+	if (mpz_inp_raw(ckpt->N, file) == 0) { goto fail; }
+
+	/* every factor is at least 2 */
+	if (read_factors(file, &(ckpt->minus), &(ckpt->count_minus), mpz_sizeinbase(ckpt->N, 2)) ||
+			read_factors(file, &(ckpt->plus), &(ckpt->count_plus), mpz_sizeinbase(ckpt->N, 2) + 1)) {
+		goto fail;
+	}
+
+	if ( read_ui(file, &x, 4) ) { goto fail; }
+
+	for (i = 0; i < x; i++) {
+
+		unsigned long passed;
+
+		if ( read_ui(file, &passed, 4) ) { goto fail; }
+		if ( checkpoint_pass(ckpt, passed) ) { goto fail; }
+	}
+
+	if ( read_ui(file, &l, 4) ) { goto fail; }
+
+	if (l != 0) {
+
+		if (read_ui(file, &stage, 4) || read_ui(file, &bit, 8) ||
+				read_ui(file, &ring, 4) || read_ui(file, &size, 4)) { goto fail; }
+
+		if (l > CYCLO_MAX_SIZE || (ring != CYCLO_RING_CYCLIC && ring != CYCLO_RING_PHI)) { goto fail; }
+
+		cmatrix_init(&(ckpt->acc), l, ring);
+		cmatrix_init(&(ckpt->power), l, ring);
+		cmatrix_init(&(ckpt->base), l, ring);
+
+		if (ckpt->acc.size != size || read_cmatrix(file, &(ckpt->acc)) ||
+				read_cmatrix(file, &(ckpt->power)) || read_cmatrix(file, &(ckpt->base))) {
+			cmatrix_free(&(ckpt->acc));
+			cmatrix_free(&(ckpt->power));
+			cmatrix_free(&(ckpt->base));
+			goto fail;
+		}
+
+		ckpt->pending = 1;
+		ckpt->pending_l = l;
+		ckpt->pending_stage = stage;
+		ckpt->pending_bit = bit;
+	}
+
+	fclose(file);
+
+	ckpt->started = 1;
+	ckpt->last = time(NULL);
+
+	return 0;
+
+fail:
+	fclose(file);
+
+	clear_factors(&(ckpt->minus), &(ckpt->count_minus));
+	clear_factors(&(ckpt->plus), &(ckpt->count_plus));
+	ckpt->count = 0;
+
+	return -1;
+}
+
+
+/*
+ * checkpoint_save(): write the proof, with the state acc, power, bit of cmatrix_power()
+ * raising base when an exponentiation is in progress
+ *
+ * return: 0 on success, -1 otherwise
+ */
+int checkpoint_save(struct checkpoint *ckpt, struct cmatrix *acc, struct cmatrix *power,
+		struct cmatrix *base, mp_bitcnt_t bit)
+{
+	/* sanity check */
+	if (!ckpt || !ckpt->started) return -1;
+
+	int ret = 0;
+	unsigned int i;
+	char *tmp;
+	FILE *file;
+
+	tmp = malloc(strlen(ckpt->path) + sizeof(".tmp"));
+	if ( !tmp ) { return -1; }
+
+	sprintf(tmp, "%s.tmp", ckpt->path);
+
+	file = fopen(tmp, "wb");
+	if ( !file ) { free(tmp); return -1; }
+
+	if (fwrite(CHECKPOINT_MAGIC, 1, sizeof(CHECKPOINT_MAGIC) - 1, file) != sizeof(CHECKPOINT_MAGIC) - 1) {
+		ret = -1;
+	}
+
+	ret |= write_ui(file, CHECKPOINT_VERSION, 4);
+	ret |= write_ui(file, ckpt->options, 4);
+	if (mpz_out_raw(file, ckpt->N) == 0) { ret = -1; }
+
+	ret |= write_factors(file, ckpt->minus, ckpt->count_minus);
+	ret |= write_factors(file, ckpt->plus, ckpt->count_plus);
+
+	ret |= write_ui(file, ckpt->count, 4);
+	for (i = 0; i < ckpt->count; i++) {
+		ret |= write_ui(file, ckpt->passed[i], 4);
+	}
+
+	if (acc && power && base && ckpt->l != 0) {
+
+		ret |= write_ui(file, ckpt->l, 4);
+		ret |= write_ui(file, ckpt->stage, 4);
+		ret |= write_ui(file, bit, 8);
+		ret |= write_ui(file, acc->ring, 4);
+		ret |= write_ui(file, acc->size, 4);
+		ret |= write_cmatrix(file, acc);
+		ret |= write_cmatrix(file, power);
+		ret |= write_cmatrix(file, base);
+
+	} else {
+		ret |= write_ui(file, 0, 4);
+	}
+
+	/* on disk before it replaces the previous checkpoint */
+	if (fflush(file) != 0 || fsync(fileno(file)) != 0) { ret = -1; }
+	if (fclose(file) != 0) { ret = -1; }
+
+	if (ret == 0 && rename(tmp, ckpt->path) != 0) { ret = -1; }
+
+	if ( ret ) { remove(tmp); }
+
+	/* free mem */
+	free(tmp);
+
+	ckpt->last = time(NULL);
+
+	return ret;
+}
+
+
+int checkpoint_remove(struct checkpoint *ckpt)
+{
+	/* sanity check */
+	if (!ckpt) return -1;
+
+	return remove(ckpt->path);
+}
+
+
+/*
+ * checkpoint_begin(): the proof of N with the known prime factors minus of N-1 and
+ * plus of N+1 and options starts, or resumes if the checkpoint was loaded
+ *
+ * return: 0 on success, -1 if a loaded checkpoint is of another proof
+ */
+int checkpoint_begin(struct checkpoint *ckpt, mpz_t N, mpz_t *minus, unsigned int count_minus,
+		mpz_t *plus, unsigned int count_plus, unsigned int options)
+{
+	/* sanity check */
+	if (!ckpt || !N) return -1;
+
+	if ( ckpt->started ) {
+		return (mpz_cmp(ckpt->N, N) == 0 && ckpt->options == options &&
+				same_factors(ckpt->minus, ckpt->count_minus, minus, count_minus) &&
+				same_factors(ckpt->plus, ckpt->count_plus, plus, count_plus)) ? 0 : -1;
+	}
+
+	if (copy_factors(&(ckpt->minus), &(ckpt->count_minus), minus, count_minus) ||
+			copy_factors(&(ckpt->plus), &(ckpt->count_plus), plus, count_plus)) {
+		clear_factors(&(ckpt->minus), &(ckpt->count_minus));
+		clear_factors(&(ckpt->plus), &(ckpt->count_plus));
+		return -1;
+	}
+
+	mpz_set(ckpt->N, N);
+	ckpt->options = options;
+	ckpt->started = 1;
+	ckpt->last = time(NULL);
+
+	return 0;
+}
+
+
+/*
+ * checkpoint_due(): an exponentiation is in progress and it is time to save it
+ */
+int checkpoint_due(struct checkpoint *ckpt)
+{
+	return ckpt && ckpt->started && ckpt->l != 0 && elapsed(ckpt);
+}
+
+
+/*
+ * checkpoint_restore(): the accumulator, running square, base and next bit of
+ * cmatrix_power() if the loaded exponentiation is the one in progress, at most once
+ *
+ * return: 1 if restored, 0 otherwise
+ */
+int checkpoint_restore(struct checkpoint *ckpt, struct cmatrix *acc, struct cmatrix *power,
+		struct cmatrix *base, mp_bitcnt_t *bit)
+{
+	/* sanity check */
+	if (!ckpt || !acc || !power || !base || !bit) return 0;
+
+	if (!ckpt->pending || ckpt->pending_l != ckpt->l || ckpt->pending_stage != ckpt->stage) {
+		return 0;
+	}
+
+	if (acc->size != ckpt->acc.size || acc->ring != ckpt->acc.ring) { return 0; }
+
+	cmatrix_copy(acc, &(ckpt->acc));
+	cmatrix_copy(power, &(ckpt->power));
+	cmatrix_copy(base, &(ckpt->base));
+	*bit = ckpt->pending_bit;
+
+	/* free mem */
+	cmatrix_free(&(ckpt->acc));
+	cmatrix_free(&(ckpt->power));
+	cmatrix_free(&(ckpt->base));
+	ckpt->pending = 0;
+
+	return 1;
+}
+
+
+/*
+ * checkpoint_pass(): the test of l passed, saved with the next checkpoint
+ *
+ * return: 0 on success, -1 otherwise
+ */
+int checkpoint_pass(struct checkpoint *ckpt, unsigned int l)
+{
+	/* sanity check */
+	if (!ckpt) return -1;
+
+	if (ckpt->count == ckpt->alloc) {
+
+		unsigned int alloc = ckpt->alloc ? 2 * ckpt->alloc : 64;
+		unsigned int *passed = realloc(ckpt->passed, alloc * sizeof(unsigned int));
+
+		if ( !passed ) { return -1; }
+
+		ckpt->passed = passed;
+		ckpt->alloc = alloc;
+	}
+
+	ckpt->passed[ckpt->count++] = l;
+
+	if (ckpt->started && ckpt->l == 0 && elapsed(ckpt)) {
+		return checkpoint_save(ckpt, NULL, NULL, NULL, 0);
+	}
+
+	return 0;
+}
+
+
+/*
+ * checkpoint_passed(): the test of l passed before the checkpoint
+ */
+int checkpoint_passed(struct checkpoint *ckpt, unsigned int l)
+{
+	unsigned int i;
+
+	if (!ckpt) return 0;
+
+	for (i = 0; i < ckpt->count; i++) {
+		if (ckpt->passed[i] == l) { return 1; }
+	}
+
+	return 0;
+}
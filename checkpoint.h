@@ -0,0 +1,98 @@
+/*
+ * Copyright 2022 Paolo Tassotti
+ *
+ * This file is part of Primality.
+ *
+ * Primality is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU General Public License as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * Primality is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with Primality.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ *  checkpoint.h
+ */
+
+#ifndef __CHECKPOINT_H
+#define __CHECKPOINT_H
+
+
+/* Includes */
+#include <time.h>
+#include "gmp.h"
+#include "cmatrix.h"
+
+
+/* Constants */
+#define CHECKPOINT_MAGIC	"PRIMCKPT"
+#define CHECKPOINT_VERSION	3
+#define CHECKPOINT_INTERVAL	600		/* default seconds between two saves */
+
+
+/* Structures Declarations */
+
+/*
+ * State of a proof by is_prime_checkpoint(), saved every interval seconds:
+ *
+ *		N and the options of the proof, the known prime factors of N-1 and N+1,
+ *		the moduli l whose cpseudo_fibo() test passed,
+ *		the exponentiation in progress: l, the stage of cpseudo_fibo() and the next
+ *		bit of N with the accumulator, running square and base of cmatrix_power()
+ *
+ * The file is written as path.tmp and renamed over path, so that a crash while
+ * saving leaves the previous checkpoint intact. Integers are big endian, the
+ * coordinates are written by mpz_out_raw().
+ *
+ */
+struct checkpoint {
+	char *path;
+	unsigned int interval;
+	time_t last;					/* time of the last save */
+
+	mpz_t N;
+	unsigned int options;
+	unsigned int started;			/* N and options are set */
+
+	unsigned int count_minus, count_plus;
+	mpz_t *minus, *plus;			/* known prime factors of N-1 and N+1 */
+
+	unsigned int count, alloc;
+	unsigned int *passed;			/* moduli l proven, in order */
+
+	unsigned int l, stage;			/* exponentiation in progress, l = 0 if none */
+
+	/* read by checkpoint_load(), until cmatrix_power() picks it up */
+	unsigned int pending;
+	unsigned int pending_l, pending_stage;
+	mp_bitcnt_t pending_bit;
+	struct cmatrix acc, power, base;
+};
+
+
+/* Functions Declarations */
+
+int checkpoint_init(struct checkpoint *, const char *, unsigned int);
+int checkpoint_free(struct checkpoint *);
+
+int checkpoint_load(struct checkpoint *);
+int checkpoint_save(struct checkpoint *, struct cmatrix *, struct cmatrix *, struct cmatrix *,
+		mp_bitcnt_t);
+int checkpoint_remove(struct checkpoint *);
+
+int checkpoint_begin(struct checkpoint *, mpz_t, mpz_t *, unsigned int, mpz_t *, unsigned int,
+		unsigned int);
+int checkpoint_due(struct checkpoint *);
+int checkpoint_restore(struct checkpoint *, struct cmatrix *, struct cmatrix *, struct cmatrix *,
+		mp_bitcnt_t *);
+
+int checkpoint_pass(struct checkpoint *, unsigned int);
+int checkpoint_passed(struct checkpoint *, unsigned int);
+
+#endif
@@ -23,6 +23,7 @@
 /* Includes */
 #include <stdio.h>
 #include "cmatrix.h"
+#include "checkpoint.h"
 
 
 /* public functions */
@@ -30,27 +31,25 @@
 /*
  *  cmatrix_init(): initialization function
  */
-int cmatrix_init(struct cmatrix *matrix, unsigned int size)
+int cmatrix_init(struct cmatrix *matrix, unsigned int q, unsigned int ring)
 {
 	/* sanity check */
 	if (!matrix) return -1;
 
 	/* initialize matrix elements */
-	matrix->size = size;
-	cyclo_init(&(matrix->q11), size);
-	cyclo_init(&(matrix->q12), size);
-	cyclo_init(&(matrix->q21), size);
-	cyclo_init(&(matrix->q22), size);
+	matrix->size = cyclo_ring_size(q, ring);
+	matrix->order = q;
+	matrix->ring = ring;
+	cyclo_init_ring(&(matrix->q12), q, ring);
+	cyclo_init_ring(&(matrix->q22), q, ring);
 
 	/* local variables */
 	mpz_t one;
 
 	mpz_init_set_ui(one, 1);
 
-	/* set initial values */
-	cyclo_set_coord(&(matrix->q11), one, 1);
+	/* set initial values (q11 = zeta follows from q12 = 1, q22 = 0) */
 	cyclo_set_coord(&(matrix->q12), one, 0);
-	cyclo_set_coord(&(matrix->q21), one, 0);
 
 	/* free mem */
 	mpz_clear(one);
@@ -62,25 +61,24 @@ int cmatrix_init(struct cmatrix *matrix, unsigned int size)
 /*
  *  cmatrix_init_identity(): create an identity matrix
  */
-int cmatrix_init_identity(struct cmatrix *matrix, unsigned int size)
+int cmatrix_init_identity(struct cmatrix *matrix, unsigned int q, unsigned int ring)
 {
 	/* sanity check */
 	if (!matrix) return -1;
 
 	/* initialize matrix elements */
-	matrix->size = size;
-	cyclo_init(&(matrix->q11), size);
-	cyclo_init(&(matrix->q12), size);
-	cyclo_init(&(matrix->q21), size);
-	cyclo_init(&(matrix->q22), size);
+	matrix->size = cyclo_ring_size(q, ring);
+	matrix->order = q;
+	matrix->ring = ring;
+	cyclo_init_ring(&(matrix->q12), q, ring);
+	cyclo_init_ring(&(matrix->q22), q, ring);
 
 	/* local variables */
 	mpz_t one;
 
 	mpz_init_set_ui(one, 1);
 
-	/* set initial values */
-	cyclo_set_coord(&(matrix->q11), one, 0);
+	/* set initial values (q11 = 1 follows from q12 = 0, q22 = 1) */
 	cyclo_set_coord(&(matrix->q22), one, 0);
 
 	/* free mem */
@@ -99,9 +97,7 @@ int cmatrix_free(struct cmatrix *matrix)
 	if (!matrix) return -1;
 
 	/* free mem */
-	cyclo_free(&(matrix->q11));
 	cyclo_free(&(matrix->q12));
-	cyclo_free(&(matrix->q21));
 	cyclo_free(&(matrix->q22));
 
 	return 0;
@@ -118,9 +114,8 @@ int cmatrix_copy(struct cmatrix *dst, struct cmatrix *src)
 
 	/* copy values */
 	dst->size = src->size;
-	cyclo_copy(&(dst->q11), &(src->q11));
+	dst->order = src->order;
 	cyclo_copy(&(dst->q12), &(src->q12));
-	cyclo_copy(&(dst->q21), &(src->q21));
 	cyclo_copy(&(dst->q22), &(src->q22));
 
 	return 0;
@@ -137,8 +132,6 @@ int cmatrix_set_identity(struct cmatrix *matrix)
 
 	/* zero on the secondary diagonal */
 	cyclo_zero(&(matrix->q12));
-	cyclo_zero(&(matrix->q21));
-	cyclo_zero(&(matrix->q11));
 	cyclo_zero(&(matrix->q22));
 
 	/* local variables */
@@ -146,8 +139,7 @@ int cmatrix_set_identity(struct cmatrix *matrix)
 
 	mpz_init_set_ui(one, 1);
 
-	/* one on the main diagonal */
-	cyclo_set_coord(&(matrix->q11), one, 0);
+	/* one on the main diagonal (q11 = zeta * q12 + q22 = 1) */
 	cyclo_set_coord(&(matrix->q22), one, 0);
 
 	/* free mem */
@@ -157,53 +149,306 @@ int cmatrix_set_identity(struct cmatrix *matrix)
 }
 
 
+/*
+ *  pack_matrix(): pack q11, q12 and q22 of a matrix, see cyclo_pack()
+ */
+static void pack_matrix(
+	mpz_t p11,
+	mpz_t p12,
+	mpz_t p22,
+	struct cmatrix *m,
+	mpz_t N,
+	struct cmatrix_workspace *ws)
+{
+	cyclo_mult_by_zeta(&(ws->tmp), &(m->q12));
+	cyclo_add(&(ws->q11), &(ws->tmp), &(m->q22), N, &(ws->cyclo));
+
+	cyclo_pack(p11, &(ws->q11), ws->slot);
+	cyclo_pack(p12, &(m->q12), ws->slot);
+	cyclo_pack(p22, &(m->q22), ws->slot);
+}
+
+
+/*
+ *  cmatrix_mult_ks(): cmatrix_mult() on packed integers, for huge N
+ *
+ *  Each entry becomes one integer (Kronecker substitution), so a product of
+ *  entries is a single large multiplication. The sums of products are taken
+ *  on the packed integers and only the two results are unpacked and reduced.
+ *  The packing of m2 is kept in ws for the next call (ws->packed): in
+ *  cmatrix_power() the running square is first m2 of the accumulation, then
+ *  the operand of its own squaring. A square takes 3 products:
+ *
+ *		r12 = m_12 * (m_11 + m_22)
+ *		r22 = m_12^2 + m_22^2
+ */
+static int cmatrix_mult_ks(
+	struct cmatrix *result,
+	struct cmatrix *m1,
+	struct cmatrix *m2,
+	mpz_t N,
+	struct cmatrix_workspace *ws)
+{
+	/* packed m2, unless still held from the previous call */
+	if (ws->packed != m2) {
+		pack_matrix(ws->b11, ws->b12, ws->b22, m2, N, ws);
+		ws->packed = m2;
+	}
+
+	if (m1 == m2) {
+
+		mpz_add(ws->t, ws->b11, ws->b22);
+		mpz_mul(ws->t12, ws->b12, ws->t);
+
+		mpz_mul(ws->t22, ws->b12, ws->b12);
+		mpz_mul(ws->t, ws->b22, ws->b22);
+		mpz_add(ws->t22, ws->t22, ws->t);
+
+	} else {
+
+		pack_matrix(ws->a11, ws->a12, ws->a22, m1, N, ws);
+
+		mpz_mul(ws->t12, ws->a11, ws->b12);
+		mpz_mul(ws->t, ws->a12, ws->b22);
+		mpz_add(ws->t12, ws->t12, ws->t);
+
+		mpz_mul(ws->t22, ws->a12, ws->b12);
+		mpz_mul(ws->t, ws->a22, ws->b22);
+		mpz_add(ws->t22, ws->t22, ws->t);
+	}
+
+	/* result may alias m1 or m2, whose packing is then stale */
+	if (ws->packed == result) {
+		ws->packed = NULL;
+	}
+
+	cyclo_unpack(&(result->q12), ws->t12, ws->slot, N, &(ws->cyclo));
+	cyclo_unpack(&(result->q22), ws->t22, ws->slot, N, &(ws->cyclo));
+
+	return 0;
+}
+
+
 /*
  *  cmatrix_mult(): standard 2x2 matrix multiplication modulo N
+ *
+ *		r12 = m1_11 * m2_12 + m1_12 * m2_22
+ *		r22 = m1_21 * m2_12 + m1_22 * m2_22
+ *
+ *  where m1_11 = zeta * m1_12 + m1_22 and m1_21 = m1_12
  */
 int cmatrix_mult(
 	struct cmatrix *result,
 	struct cmatrix *m1,
 	struct cmatrix *m2,
-	mpz_t N)
+	mpz_t N,
+	struct cmatrix_workspace *ws)
 {
-	struct cyclo tmp;
-	struct cyclo r12, r22;
-
 	/* sanity check */
-	if (!result || !m1 || !m2 || !N) return -1;
+	if (!result || !m1 || !m2 || !N || !ws) return -1;
 
-	/* ASSERT: m1->size == m2->size, checked by the caller */
-	unsigned int size = m1->size;
+	/* ASSERT: m1->size == m2->size == ws->size, checked by the caller */
+	if ( ws->ks ) {
+		ws->packed = NULL;
+		return cmatrix_mult_ks(result, m1, m2, N, ws);
+	}
+
+	struct cyclo *tmp = &(ws->tmp);
+	struct cyclo *q11 = &(ws->q11);
+	struct cyclo *r12 = &(ws->r12);
+	struct cyclo *r22 = &(ws->r22);
 
-	/* initialize local variable */
-	cyclo_init(&tmp, size);
-	cyclo_init(&r12, size);
-	cyclo_init(&r22, size);
+	/* rebuild m1_11 by the recurrence's rule without additional multiplications */
+	cyclo_mult_by_zeta(tmp, &(m1->q12));
+	cyclo_add(q11, tmp, &(m1->q22), N, &(ws->cyclo));
 
 	/* element (1,2) */
-	cyclo_mult(&r12, &(m1->q11), &(m2->q12), N);
-	cyclo_mult(&tmp, &(m1->q12), &(m2->q22), N);
-	cyclo_add(&r12, &r12, &tmp, N);
+	cyclo_mult(r12, q11, &(m2->q12), N, &(ws->cyclo));
+	cyclo_mult(tmp, &(m1->q12), &(m2->q22), N, &(ws->cyclo));
+	cyclo_add(r12, r12, tmp, N, &(ws->cyclo));
 
-	/* element (2,2) */
-	cyclo_mult(&r22, &(m1->q21), &(m2->q12), N);
-	cyclo_mult(&tmp, &(m1->q22), &(m2->q22), N);
-	cyclo_add(&r22, &r22, &tmp, N);
+	/* element (2,2), m1_21 = m1_12 since the matrix is symmetric */
+	cyclo_mult(r22, &(m1->q12), &(m2->q12), N, &(ws->cyclo));
+	cyclo_mult(tmp, &(m1->q22), &(m2->q22), N, &(ws->cyclo));
+	cyclo_add(r22, r22, tmp, N, &(ws->cyclo));
 
 	/* assign values */
-	cyclo_copy(&(result->q12), &r12);
-	cyclo_copy(&(result->q22), &r22);
-	cyclo_copy(&(result->q21), &(result->q12));	/* the matrix is symmetric */
+	cyclo_copy(&(result->q12), r12);
+	cyclo_copy(&(result->q22), r22);
+
+	return 0;
+}
+
+
+/*
+ *  cmatrix_equal(): m1 == m2 modulo N
+ */
+static int cmatrix_equal(struct cmatrix *m1, struct cmatrix *m2, mpz_t N)
+{
+	unsigned int k;
+
+	for (k = 0; k < m1->size; k++) {
+		if ( !mpz_congruent_p(m1->q12.values[k], m2->q12.values[k], N) ) { return 0; }
+		if ( !mpz_congruent_p(m1->q22.values[k], m2->q22.values[k], N) ) { return 0; }
+	}
+
+	return 1;
+}
+
+
+/*
+ *  cmatrix_power_block(): sum += the block of k from bit lo, of len bits
+ */
+static void cmatrix_power_block(mpz_t sum, mpz_t k, mp_bitcnt_t lo, mp_bitcnt_t len, mpz_t block)
+{
+	mpz_fdiv_q_2exp(block, k, lo);
+	mpz_fdiv_r_2exp(block, block, len);
+	mpz_add(sum, sum, block);
+}
+
+
+/*
+ *  cmatrix_power_gerbicz(): cmatrix_power() with a Gerbicz check of the whole chain
+ *
+ *  The bits of k are scanned from the most significant one, x = x^2 * M^bit, so that
+ *  the state is a single chain. It is cut in blocks of B bits, the first one shorter,
+ *  with X_t = x at the end of block t (X_0 = 1) and c_t the value of block t:
+ *
+ *		X_(t+1) = X_t^(2^B) * M^(c_t)
+ *
+ *  The checksum D_t = X_1 * ... * X_t costs one product per block, and
+ *
+ *		D_t = D_(t-1)^(2^B) * M^(c_0 + ... + c_(t-1))
+ *
+ *  holds iff no error occurred, an error E in any X_j leaves a factor E between the
+ *  two sides. It is checked every B blocks and at the end, at the cost of about 2.5 B
+ *  products. A failed check rolls back to the last good X and D. The products of the
+ *  check itself are not trusted: a failure there only causes a useless rollback.
+ *
+ *  With ws->checkpoint, only checked states are saved, bit = the bits scanned.
+ */
+static int cmatrix_power_gerbicz(
+	struct cmatrix *result,
+	struct cmatrix *matrix,
+	mpz_t k,
+	mpz_t N,
+	struct cmatrix_workspace *ws)
+{
+	struct cmatrix *x = &(ws->acc);
+	struct cmatrix *d = &(ws->power);
+	struct cmatrix *prev = &(ws->prev);
+	struct cmatrix *check = &(ws->check);
+
+	mp_bitcnt_t i = 0, j, end, bits = mpz_sizeinbase(k, 2);
+	mp_bitcnt_t B, first, good_i;
+	unsigned long t, good_t;
+	unsigned int retries = 0;
+
+	/* B = sqrt(bits): the checksum and the checks cost about 3.5 sqrt(bits) products */
+	for (B = 1; (B + 1) * (B + 1) <= bits && B < CMATRIX_GERBICZ_BLOCK; B++) ;
+
+	first = bits % B;
+	if (first == 0) { first = B; }
+
+	/* resume at a checked state of a loaded checkpoint */
+	if ( !checkpoint_restore(ws->checkpoint, x, d, matrix, &i) ) {
+		i = 0;
+		cmatrix_set_identity(x);
+		cmatrix_set_identity(d);
+	}
+
+	/* blocks scanned, and the sum of their values */
+	mpz_set_ui(ws->sum, 0);
+	t = 0;
+
+	for (end = first; end <= i; end += B) {
+		cmatrix_power_block(ws->sum, k, bits - end, (t == 0) ? first : B, ws->block);
+		t++;
+	}
+
+	good_i = i;
+	good_t = t;
+	cmatrix_copy(&(ws->good_x), x);
+	cmatrix_copy(&(ws->good_d), d);
+	mpz_set(ws->good_sum, ws->sum);
+
+	while (i < bits) {
+
+		end = (t == 0) ? first : i + B;
+
+		for (; i < end; i++) {
+
+			cmatrix_mult(x, x, x, N, ws);
+
+			if (mpz_tstbit(k, bits - 1 - i)) {
+				cmatrix_mult(x, x, matrix, N, ws);
+			}
+		}
+
+		cmatrix_power_block(ws->sum, k, bits - end, (t == 0) ? first : B, ws->block);
+		t++;
+
+		/* no check yet: D_t = D_(t-1) * X_t */
+		if (t % B != 0 && i < bits) {
+			cmatrix_mult(d, d, x, N, ws);
+			continue;
+		}
+
+		cmatrix_copy(prev, d);
+		cmatrix_mult(d, d, x, N, ws);
+
+		/* check = D_(t-1)^(2^B) */
+		cmatrix_copy(check, prev);
+
+		for (j = 0; j < B; j++) {
+			cmatrix_mult(check, check, check, N, ws);
+		}
+
+		/* prev = M^sum, from the most significant bit */
+		cmatrix_set_identity(prev);
+
+		for (j = mpz_sizeinbase(ws->sum, 2); j-- > 0; ) {
+
+			cmatrix_mult(prev, prev, prev, N, ws);
+
+			if (mpz_tstbit(ws->sum, j)) {
+				cmatrix_mult(prev, prev, matrix, N, ws);
+			}
+		}
+
+		cmatrix_mult(check, check, prev, N, ws);
 
-	/* compute r11 by the recurrence's rule without additional multiplications */
-	/* q11 = zeta * q12 + q22 */
-	cyclo_mult_by_zeta(&tmp, &(result->q12));
-	cyclo_add(&(result->q11), &tmp, &(result->q22), N);
+		if ( cmatrix_equal(check, d, N) ) {
 
-	/* free memory */
-	cyclo_free(&tmp);
-	cyclo_free(&r12);
-	cyclo_free(&r22);
+			retries = 0;
+
+			good_i = i;
+			good_t = t;
+			cmatrix_copy(&(ws->good_x), x);
+			cmatrix_copy(&(ws->good_d), d);
+			mpz_set(ws->good_sum, ws->sum);
+
+			if ( checkpoint_due(ws->checkpoint) ) {
+				checkpoint_save(ws->checkpoint, x, d, matrix, i);
+			}
+
+		} else {
+
+			ws->errors++;
+
+			if (++retries > CMATRIX_GERBICZ_RETRIES) { return -1; }
+
+			/* roll back */
+			i = good_i;
+			t = good_t;
+			cmatrix_copy(x, &(ws->good_x));
+			cmatrix_copy(d, &(ws->good_d));
+			mpz_set(ws->sum, ws->good_sum);
+		}
+	}
+
+	/* store result matrix */
+	cmatrix_copy(result, x);
 
 	return 0;
 }
@@ -211,64 +456,242 @@ int cmatrix_mult(
 
 /*
  *  cmatrix_power(): calculates the kth power modulo N of given matrix
+ *
+ *  With ws->checkpoint, the state is saved when due and a loaded one for the same
+ *  exponentiation replaces it, matrix included, see checkpoint_restore().
  */
 int cmatrix_power(
 	struct cmatrix *result,
 	struct cmatrix *matrix,
 	mpz_t k,
-	mpz_t N)
+	mpz_t N,
+	struct cmatrix_workspace *ws)
 {
-	mpz_t exp;
-	struct cmatrix tmp, power;
-
 	/* sanity check */
-	if (!result || !matrix || !k || !N) return -1;
-
-	unsigned int size = matrix->size;
+	if (!result || !matrix || !k || !N || !ws) return -1;
 
 	if (mpz_cmp_ui(k, 0) == 0) {
-		cmatrix_init_identity(result, size);
+		cmatrix_set_identity(result);
 		return 0;
 	}
 
-	mpz_init(exp);
-	mpz_set(exp, k);
+	if ( ws->gerbicz ) {
+		return cmatrix_power_gerbicz(result, matrix, k, N, ws);
+	}
+
+	struct cmatrix *tmp = &(ws->acc);
+	struct cmatrix *power = &(ws->power);
+
+	/* scan the bits of k from the least significant one */
+	mp_bitcnt_t i = 0, bits = mpz_sizeinbase(k, 2);
 
-	cmatrix_init_identity(&tmp, size);
-	cmatrix_init(&power, size);
+	/* resume at bit i of a loaded checkpoint */
+	if ( !checkpoint_restore(ws->checkpoint, tmp, power, matrix, &i) ) {
+		cmatrix_set_identity(tmp);
+		cmatrix_copy(power, matrix);
+	}
 
-	cmatrix_copy(&power, matrix);
+	ws->packed = NULL;
 
-    while ( mpz_cmp_ui(exp, 0) > 0 ) {	/* k > 0 */
+	for (; i < bits; i++) {
 
-		if (!mpz_divisible_ui_p(exp, 2)) {		/* if k is odd */
-			cmatrix_mult(&tmp, &tmp, &power, N);
+		/* ASSERT: tmp = matrix^(k mod 2^i), power = matrix^(2^i) */
+		if ( checkpoint_due(ws->checkpoint) ) {
+			checkpoint_save(ws->checkpoint, tmp, power, matrix, i);
 		}
 
-		cmatrix_mult(&power, &power, &power, N);
+		if (mpz_tstbit(k, i)) {		/* if bit i of k is set */
+			if ( ws->ks ) {
+				cmatrix_mult_ks(tmp, tmp, power, N, ws);
+			} else {
+				cmatrix_mult(tmp, tmp, power, N, ws);
+			}
+		}
 
-		/* exp = exp / 2 */
-		mpz_tdiv_q_2exp(exp, exp, 1);
+		/* the last squaring would be discarded */
+		if (i + 1 < bits) {
+			if ( ws->ks ) {
+				cmatrix_mult_ks(power, power, power, N, ws);
+			} else {
+				cmatrix_mult(power, power, power, N, ws);
+			}
+		}
 	}
- 
+
 	/* store result matrix */
-	cmatrix_copy(result, &tmp);
+	cmatrix_copy(result, tmp);
 
-	/* free mem */
-	mpz_clear(exp);
-	cmatrix_free(&tmp);
-	cmatrix_free(&power);
+	return 0;
+}
+
+
+/*
+ *  cmatrix_power_iter(): calculates the (k^count)th power modulo N of given matrix
+ *
+ *  the exponent k^count is never materialized: the matrix is raised to the kth power
+ *  count times in sequence, so memory stays proportional to the size of k
+ */
+int cmatrix_power_iter(
+	struct cmatrix *result,
+	struct cmatrix *matrix,
+	mpz_t k,
+	unsigned int count,
+	mpz_t N,
+	struct cmatrix_workspace *ws)
+{
+	int ret = 0;
+	unsigned int i;
+
+	/* sanity check */
+	if (!result || !matrix || !k || !N || !ws) return -1;
+
+	if (result != matrix) {
+		cmatrix_copy(result, matrix);
+	}
+
+	for (i = 0; i < count; i++) {
+
+		ret = cmatrix_power(result, result, k, N, ws);
+		if ( ret ) { return -1; }
+	}
 
 	return 0;
 }
 
 
-int cmatrix_getvalue_11(struct cyclo *value, struct cmatrix *matrix)
+/*
+ *  cmatrix_workspace_init(): allocate the scratch buffers of cmatrix_mult() and
+ *                            cmatrix_power() for the given size and modulus N
+ */
+int cmatrix_workspace_init(
+	struct cmatrix_workspace *ws,
+	unsigned int q,
+	unsigned int ring,
+	mpz_t N)
 {
 	/* sanity check */
-	if (!matrix || !value) return -1;
+	if (!ws || !N) return -1;
+
+	int ret = 0;
 
-	cyclo_copy(value, &(matrix->q11));
+	ws->size = cyclo_ring_size(q, ring);
+
+	ret = cyclo_workspace_init(&(ws->cyclo), ws->size, N);
+	if ( ret ) { return -1; }
+
+	/* products are reduced modulo N only by cyclo_add() */
+	mp_bitcnt_t bits = 2 * mpz_sizeinbase(N, 2) + 32;
+
+	cyclo_init2(&(ws->tmp), q, ring, bits);
+	cyclo_init2(&(ws->q11), q, ring, bits);
+	cyclo_init2(&(ws->r12), q, ring, bits);
+	cyclo_init2(&(ws->r22), q, ring, bits);
+
+	cmatrix_init_identity(&(ws->acc), q, ring);
+	cmatrix_init_identity(&(ws->power), q, ring);
+
+	/* packed entries: a slot holds a sum of 2*size products of coordinates < 2N */
+	ws->ks = (mpz_sizeinbase(N, 2) >= CMATRIX_KS_MIN_BITS) ? 1 : 0;
+	ws->slot = (bits + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
+	ws->packed = NULL;
+
+	ws->checkpoint = NULL;
+
+	ws->gerbicz = 0;
+	ws->errors = 0;
+
+	mpz_init(ws->a11);
+	mpz_init(ws->a12);
+	mpz_init(ws->a22);
+	mpz_init(ws->b11);
+	mpz_init(ws->b12);
+	mpz_init(ws->b22);
+	mpz_init(ws->t12);
+	mpz_init(ws->t22);
+	mpz_init(ws->t);
+
+	return 0;
+}
+
+
+/*
+ *  cmatrix_workspace_gerbicz(): check every cmatrix_power() with ws, see cmatrix_power_gerbicz()
+ */
+int cmatrix_workspace_gerbicz(struct cmatrix_workspace *ws, unsigned int q, unsigned int ring)
+{
+	/* sanity check */
+	if (!ws) return -1;
+
+	if ( ws->gerbicz ) { return 0; }
+
+	cmatrix_init_identity(&(ws->prev), q, ring);
+	cmatrix_init_identity(&(ws->good_x), q, ring);
+	cmatrix_init_identity(&(ws->good_d), q, ring);
+	cmatrix_init_identity(&(ws->check), q, ring);
+	mpz_init(ws->sum);
+	mpz_init(ws->good_sum);
+	mpz_init(ws->block);
+
+	ws->gerbicz = 1;
+
+	return 0;
+}
+
+
+/*
+ * cmatrix_workspace_free(): free memory
+ */
+int cmatrix_workspace_free(struct cmatrix_workspace *ws)
+{
+	/* sanity check */
+	if (!ws) return -1;
+
+	cyclo_workspace_free(&(ws->cyclo));
+
+	cyclo_free(&(ws->tmp));
+	cyclo_free(&(ws->q11));
+	cyclo_free(&(ws->r12));
+	cyclo_free(&(ws->r22));
+
+	cmatrix_free(&(ws->acc));
+	cmatrix_free(&(ws->power));
+
+	if ( ws->gerbicz ) {
+		cmatrix_free(&(ws->prev));
+		cmatrix_free(&(ws->good_x));
+		cmatrix_free(&(ws->good_d));
+		cmatrix_free(&(ws->check));
+		mpz_clear(ws->sum);
+		mpz_clear(ws->good_sum);
+		mpz_clear(ws->block);
+		ws->gerbicz = 0;
+	}
+
+	mpz_clear(ws->a11);
+	mpz_clear(ws->a12);
+	mpz_clear(ws->a22);
+	mpz_clear(ws->b11);
+	mpz_clear(ws->b12);
+	mpz_clear(ws->b22);
+	mpz_clear(ws->t12);
+	mpz_clear(ws->t22);
+	mpz_clear(ws->t);
+
+	return 0;
+}
+
+
+/*
+ *  cmatrix_getvalue_11(): q11 is not stored, compute it as zeta * q12 + q22 modulo N
+ */
+int cmatrix_getvalue_11(struct cyclo *value, struct cmatrix *matrix, mpz_t N)
+{
+	/* sanity check */
+	if (!matrix || !value || !N) return -1;
+
+	/* ASSERT: value is neither q12 nor q22 of matrix */
+	cyclo_mult_by_zeta(value, &(matrix->q12));
+	cyclo_add(value, value, &(matrix->q22), N, NULL);
 
 	return 0;
 }
@@ -296,21 +719,29 @@ int cmatrix_getvalue_22(struct cyclo *value, struct cmatrix *matrix)
 }
 
 
-int cmatrix_print(struct cmatrix *matrix)
+int cmatrix_print(struct cmatrix *matrix, mpz_t N)
 {
 	/* sanity check */
-	if (!matrix) return -1;
+	if (!matrix || !N) return -1;
+
+	struct cyclo q11;
+
+	cyclo_init_ring(&q11, matrix->order, matrix->ring);
+	cmatrix_getvalue_11(&q11, matrix, N);
 
 	printf("[ ");
-	cyclo_print(&(matrix->q11));
+	cyclo_print(&q11);
 	printf(", ");
 	cyclo_print(&(matrix->q12));
 	printf(" ]\n[ ");
-	cyclo_print(&(matrix->q21));
+	cyclo_print(&(matrix->q12));	/* q21 = q12 */
 	printf(", ");
 	cyclo_print(&(matrix->q22));
 	printf(" ]\n");
 
+	/* free mem */
+	cyclo_free(&q11);
+
 	return 0;
 }
 
@@ -323,10 +754,11 @@ int cmatrix_test()
 	unsigned int size = 3;
 	mpz_t exp, N;
 	struct cmatrix m1, m2, r;
+	struct cmatrix_workspace ws;
 
-	cmatrix_init(&m1, size);
-	cmatrix_init(&m2, size);
-	cmatrix_init(&r, size);
+	cmatrix_init(&m1, size, CYCLO_RING_CYCLIC);
+	cmatrix_init(&m2, size, CYCLO_RING_CYCLIC);
+	cmatrix_init(&r, size, CYCLO_RING_CYCLIC);
 
 	mpz_init(exp);
 	mpz_set_ui(exp, 4);
@@ -334,45 +766,46 @@ int cmatrix_test()
 	mpz_init(N);
 	mpz_set_ui(N, 110);
 
+	cmatrix_workspace_init(&ws, size, CYCLO_RING_CYCLIC, N);
 
-/*	cmatrix_mult(&r, &m1, &m1);
+/*	cmatrix_mult(&r, &m1, &m1, N, &ws);
 */
 
-/*	cmatrix_power(&r, &m1, k, N);
+/*	cmatrix_power(&r, &m1, k, N, &ws);
 */
 
 	printf("q-matrix:\n");
-	cmatrix_print(&m1);
+	cmatrix_print(&m1, N);
 	printf("\n");
 
 	printf("identity:\n");
 	cmatrix_set_identity(&m2);
-	cmatrix_print(&m2);
+	cmatrix_print(&m2, N);
 	printf("\n");
 
 	printf("copy of q-matrix:\n");
 	cmatrix_copy(&r, &m1);
-	cmatrix_print(&r);
+	cmatrix_print(&r, N);
 	printf("\n");
 
 	printf("square of q-matrix:\n");
-	cmatrix_mult(&r, &m1, &m1, N);
-	cmatrix_print(&r);
+	cmatrix_mult(&r, &m1, &m1, N, &ws);
+	cmatrix_print(&r, N);
 	printf("\n");
 /*
 	printf("third power of q-matrix:\n");
-	cmatrix_mult(&r, &r, &m1, N);
-	cmatrix_print(&r);
+	cmatrix_mult(&r, &r, &m1, N, &ws);
+	cmatrix_print(&r, N);
 	printf("\n");
 
 	printf("fourth power of q-matrix:\n");
-	cmatrix_power(&r, &m1, exp, N);
-	cmatrix_print(&r);
+	cmatrix_power(&r, &m1, exp, N, &ws);
+	cmatrix_print(&r, N);
 	printf("\n");
 */
 	printf("fourth power of q-matrix:\n");
-	cmatrix_mult(&r, &r, &r, N);
-	cmatrix_print(&r);
+	cmatrix_mult(&r, &r, &r, N, &ws);
+	cmatrix_print(&r, N);
 	printf("\n");
 
 
@@ -380,6 +813,7 @@ int cmatrix_test()
 	cmatrix_free(&m1);
 	cmatrix_free(&m2);
 	cmatrix_free(&r);
+	cmatrix_workspace_free(&ws);
 
 	mpz_clear(exp);
 	mpz_clear(N);
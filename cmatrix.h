@@ -29,8 +29,16 @@
 #include "cyclo.h"
 
 
+/* Constants */
+#define CMATRIX_KS_MIN_BITS	65536	/* N from which cmatrix_mult() works on packed integers */
+#define CMATRIX_GERBICZ_BLOCK	1000	/* largest block of bits between two checksum updates */
+#define CMATRIX_GERBICZ_RETRIES	3		/* failed checks in a row before giving up */
+
+
 /* Structures Declarations */
 
+struct checkpoint;		/* see checkpoint.h */
+
 /*
  * Represents the kth power modulo N of the Q-matrix for Cyclotomic Fibonacci numbers
  *
@@ -43,31 +51,72 @@
  *		q12 = q21 = 1,
  *		q22 = 0
  *
+ * Only q12 and q22 are stored: the matrix is symmetric (q21 = q12) and
+ * q11 = zeta * q12 + q22 by the recurrence's rule, so it is computed on demand.
+ *
  */
 struct cmatrix {
 	unsigned int size;	/* size of the algebraic integers*/
-	struct cyclo q11, q12, q21, q22;
+	unsigned int order;	/* q, zeta is a qth root of unity */
+	unsigned int ring;	/* their representation, see cyclo.h */
+	struct cyclo q12, q22;
+};
+
+
+/*
+ * Scratch buffers for cmatrix_mult() and cmatrix_power(), preallocated once
+ * for a given size and modulus N and threaded through the exponentiation
+ *
+ */
+struct cmatrix_workspace {
+	unsigned int size;
+	struct cyclo_workspace cyclo;	/* scratch of cyclo_mult() */
+	struct cyclo tmp, q11, r12, r22;	/* temporaries of cmatrix_mult() */
+	struct cmatrix acc, power;		/* accumulator and running square of cmatrix_power() */
+
+	/* huge N: entries packed by cyclo_pack(), see cmatrix_mult_ks() */
+	unsigned int ks;
+	mp_size_t slot;
+	mpz_t a11, a12, a22;			/* packed m1 */
+	mpz_t b11, b12, b22;			/* packed m2 */
+	mpz_t t12, t22, t;
+	struct cmatrix *packed;			/* matrix held in b11, b12, b22, or NULL */
+
+	struct checkpoint *checkpoint;	/* cmatrix_power() saves and resumes its state, or NULL */
+
+	/* Gerbicz check of cmatrix_power(), see cmatrix_workspace_gerbicz() */
+	unsigned int gerbicz;
+	unsigned int errors;			/* failed checks, rolled back */
+	struct cmatrix prev, good_x, good_d, check;
+	mpz_t sum, good_sum, block;		/* sums of the block values of k */
 };
 
 
 /* Functions Declarations */
 
-int cmatrix_init(struct cmatrix *, unsigned int);
-int cmatrix_init_identity(struct cmatrix *, unsigned int);
+int cmatrix_init(struct cmatrix *, unsigned int, unsigned int);
+int cmatrix_init_identity(struct cmatrix *, unsigned int, unsigned int);
 int cmatrix_free(struct cmatrix *);
 
 int cmatrix_copy(struct cmatrix *, struct cmatrix *);
 int cmatrix_set_identity(struct cmatrix *);
 
-int cmatrix_mult(struct cmatrix *,struct cmatrix *, struct cmatrix *, mpz_t);
-int cmatrix_power(struct cmatrix *, struct cmatrix *, mpz_t, mpz_t);
+int cmatrix_mult(struct cmatrix *,struct cmatrix *, struct cmatrix *, mpz_t,
+		struct cmatrix_workspace *);
+int cmatrix_power(struct cmatrix *, struct cmatrix *, mpz_t, mpz_t, struct cmatrix_workspace *);
+int cmatrix_power_iter(struct cmatrix *, struct cmatrix *, mpz_t, unsigned int, mpz_t,
+		struct cmatrix_workspace *);
+
+int cmatrix_workspace_init(struct cmatrix_workspace *, unsigned int, unsigned int, mpz_t);
+int cmatrix_workspace_gerbicz(struct cmatrix_workspace *, unsigned int, unsigned int);
+int cmatrix_workspace_free(struct cmatrix_workspace *);
 
-int cmatrix_getvalue_11(struct cyclo *, struct cmatrix *);
+int cmatrix_getvalue_11(struct cyclo *, struct cmatrix *, mpz_t);
 int cmatrix_getvalue_12(struct cyclo *, struct cmatrix *);
 int cmatrix_getvalue_22(struct cyclo *, struct cmatrix *);
 /* get_value21 is useless since the matrix is always symmetric */
 
-int cmatrix_print(struct cmatrix *);
+int cmatrix_print(struct cmatrix *, mpz_t);
 
 int cmatrix_test();
 
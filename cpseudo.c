@@ -22,67 +22,235 @@
 
 /* Includes */
 #include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
 #include "cmatrix.h"
+#include "checkpoint.h"
 #include "cpseudo.h"
+#include "remtree.h"
 
 /*#define DEBUG	1
 */
 /* Global variables */
-extern unsigned int primes[MAXPRIMEINDEX];
-extern struct divisors_list phi_divisors[MAXPRIMEINDEX];
-extern int prime_to_index[MAXPRIME+1];
-extern char *discriminants[MAXPRIMEINDEX];
+
+
+/* private functions */
+
+/*
+ * trace_is_zeta_power(): check whether the trace q11 + q22 of matrix is zeta^e modulo N
+ *
+ * return: 1 if it is, 0 otherwise
+ */
+static unsigned int trace_is_zeta_power(struct cmatrix *matrix, unsigned int e, mpz_t N)
+{
+	unsigned int ret = 0;
+	struct cyclo trace, zeta_e;
+
+	cyclo_init_ring(&trace, matrix->order, matrix->ring);
+	cyclo_init_ring(&zeta_e, matrix->order, matrix->ring);
+
+	cmatrix_getvalue_11(&trace, matrix, N);
+	cyclo_add(&trace, &trace, &(matrix->q22), N, NULL);
+
+	cyclo_set_zeta_power(&zeta_e, e, N);
+
+	if (cyclo_is_equal(&trace, &zeta_e) == 1) {
+		ret = 1;
+	}
+
+	/* free mem */
+	cyclo_free(&trace);
+	cyclo_free(&zeta_e);
+
+	return ret;
+}
+
+
+/*
+ * is_tabulated_prime(): check whether l is one of the small primes of the tables
+ */
+static unsigned int is_tabulated_prime(unsigned int l)
+{
+	return (table_index(l) >= 0);
+}
+
+
+/*
+ * prime_of(): the prime p of the prime power q = p^k
+ */
+static unsigned int prime_of(unsigned int q)
+{
+	unsigned int p;
+
+	for (p = 2; p * p <= q; p++) {
+		if ((q % p) == 0) { return p; }
+	}
+
+	return q;
+}
+
+
+/*
+ * scalar_mult(): product modulo N of two symmetric Fibonacci matrices
+ *				  [[a12 + a22, a12], [a12, a22]] and [[b12 + b22, b12], [b12, b22]]
+ *
+ *				  r12 and r22 may alias the operands, t12 and t22 are scratch
+ */
+static void scalar_mult(
+	mpz_t r12, mpz_t r22,
+	mpz_t a12, mpz_t a22,
+	mpz_t b12, mpz_t b22,
+	mpz_t N,
+	mpz_t t12, mpz_t t22)
+{
+	/* t12 = (a12 + a22) * b12 + a12 * b22 */
+	mpz_add(t12, a12, a22);
+	mpz_mul(t12, t12, b12);
+	mpz_addmul(t12, a12, b22);
+
+	/* t22 = a12 * b12 + a22 * b22 */
+	mpz_mul(t22, a12, b12);
+	mpz_addmul(t22, a22, b22);
+
+	mpz_mod(r12, t12, N);
+	mpz_mod(r22, t22, N);
+}
 
 
 /* public functions */
 
 
 /*
- * smallest_exp(): find the smallest exponent "f" such that N^f \equiv 1 mod(N)
+ * powm_ui(): b^e mod m by 64 bit arithmetic, m < 2^32
  */
-unsigned int smallest_exp(mpz_t N, unsigned int l)
+static uint64_t powm_ui(uint64_t b, uint64_t e, uint64_t m)
 {
-	unsigned int i;
-	unsigned int f;
-	unsigned int index;
+	uint64_t r = 1 % m;
 
-	mpz_t Nexp, l_mpz;
+	b %= m;
 
-	/* initialize local variables */
-	mpz_init(Nexp);
-	mpz_init(l_mpz);
+	while (e > 0) {
+		if (e & 1) { r = (r * b) % m; }
+		b = (b * b) % m;
+		e >>= 1;
+	}
 
-	/* ASSERT: l is supposed to be a prime number, checked by the callee */
-	f = l-1;
+	return r;
+}
 
-	mpz_set_ui(l_mpz, l);
 
-	index = prime_to_index[l];
+/*
+ * order_ui(): multiplicative order of r modulo q, in a group of order phi
+ *
+ * phi is divided by each of its prime factors p while r^(phi/p) = 1 (mod q)
+ */
+static unsigned int order_ui(unsigned long r, unsigned int q, unsigned int phi)
+{
+	unsigned int f = phi, m = phi, p;
 
-	/* ASSERT: we don't check if index is well-formed */
+	for (p = 2; m > 1; p++) {
 
-	for (i = 1; i < phi_divisors[index].count; i++) {
+		if (p * p > m) { p = m; }
 
-		unsigned int exp = phi_divisors[index].divisors[i];
+		if ((m % p) != 0) { continue; }
 
-		/* N^exp (mod N) */
-		mpz_powm_ui(Nexp, N, exp, l_mpz);
+		while ((m % p) == 0) { m /= p; }
 
-		/* is N^exp \equiv 1 (mod N) ? */
-		if ( mpz_cmp_ui(Nexp, 1) == 0 ) {
-			f = exp;
+		while ((f % p) == 0 && powm_ui(r, f / p, q) == 1) {
+			f /= p;
 		}
 	}
 
+	return f;
+}
+
+
+/*
+ * smallest_exp(): find the smallest exponent "f" such that N^f \equiv 1 mod(N)
+ */
+unsigned int smallest_exp(mpz_t N, unsigned int l)
+{
+	unsigned long r;
+
+	/* prime powers are not in the tables */
+	if ( !is_tabulated_prime(l) ) {
+		return smallest_exp_pp(N, l);
+	}
+
+	/* ASSERT: l is supposed to be a prime number, checked by the callee */
+
+	/* the only bignum operation */
+	r = mpz_fdiv_ui(N, l);
+
+	/* N = 0 (mod l) has no order, keep f = l-1 */
+	if (r == 0) { return l - 1; }
+
 #ifdef DEBUG
-		gmp_printf("N=%Zd, l=%d, exp=%d, Nexp=%Zd.\n", N, l, f, Nexp);
+	gmp_printf("N=%Zd, l=%d, exp=%d.\n", N, l, order_ui(r, l, l - 1));
 #endif
 
-	/* free mem */
-	mpz_clear(Nexp);
-	mpz_clear(l_mpz);
+	return order_ui(r, l, l - 1);
+}
 
-	return f;
+
+/*
+ * smallest_exp_pp(): smallest_exp() for a prime power q, by word-size arithmetic
+ */
+unsigned int smallest_exp_pp(mpz_t N, unsigned int q)
+{
+	unsigned long r;
+	unsigned int p = prime_of(q);
+
+	r = mpz_fdiv_ui(N, q);
+
+	/* N is not prime to q: there is no order, f is bounded by q */
+	if ((r % p) == 0) { return q; }
+
+	return order_ui(r, q, q - q / p);
+}
+
+
+/*
+ * cpseudo_discriminant(disc, q): p times the norm of zeta_q^2 + 4, for the prime power q = p^k
+ *
+ * the norm is |Phi_q(2i)|^2, with Phi_q(x) = 1 + x^s + ... + x^((p-1)s), s = q/p
+ */
+void cpseudo_discriminant(mpz_t disc, unsigned int q)
+{
+	unsigned int j, p, s;
+	mpz_t re, im, pow;
+
+	p = prime_of(q);
+	s = q / p;
+
+	mpz_init_set_ui(re, 0);
+	mpz_init_set_ui(im, 0);
+	mpz_init(pow);
+
+	for (j = 0; j < p; j++) {
+
+		unsigned long m = (unsigned long) j * s;
+
+		/* (2i)^m = 2^m i^m */
+		mpz_set_ui(pow, 0);
+		mpz_setbit(pow, m);
+
+		switch (m % 4) {
+			case 0: mpz_add(re, re, pow); break;
+			case 1: mpz_add(im, im, pow); break;
+			case 2: mpz_sub(re, re, pow); break;
+			case 3: mpz_sub(im, im, pow); break;
+		}
+	}
+
+	mpz_mul(disc, re, re);
+	mpz_addmul(disc, im, im);
+	mpz_mul_ui(disc, disc, p);
+
+	/* free mem */
+	mpz_clear(re);
+	mpz_clear(im);
+	mpz_clear(pow);
 }
 
 
@@ -91,6 +259,9 @@ unsigned int smallest_exp(mpz_t N, unsigned int l)
  *
  * where zeta_l is the lth root of unity
  *
+ * the small prime factors of the discriminant are word-size remainders of N, the gcd
+ * is only taken with what is left of it when that is not 1 or a prime
+ *
  * return: 1 if N ramify, 0 otherwise
  */
 unsigned int cpseudo_ramifies(mpz_t N, unsigned int l)
@@ -98,23 +269,243 @@ unsigned int cpseudo_ramifies(mpz_t N, unsigned int l)
 	/* sanity check */
 	if ( !N ) return -1;
 
-	/* ASSERT: l is a prime number, checked by the caller */
+	int index = table_index(l);
 
-	mpz_t disc, gcd;
+	/* prime powers and the primes beyond the static tables */
+	if (index < 0 || index >= MAXPRIMEINDEX) {
+		return cpseudo_ramifies_gcd(N, l);
+	}
+
+	unsigned int i;
 	int ret = 0;
-	unsigned int index = prime_to_index[l];
+	mpz_srcptr cofactor;
 
-	/* ASSERT: we don't check if index is well-formed */
+	for (i = disc_factors_offset[index]; i < disc_factors_offset[index+1]; i++) {
+		if (mpz_fdiv_ui(N, disc_factors[i]) == 0) { return 1; }
+	}
+
+	switch (disc_cofactors[index]) {
+
+		case DISC_COFACTOR_ONE:
+			break;
+
+		case DISC_COFACTOR_PRIME:
+			cofactor = table_cofactor(index);
+			ret = (mpz_cmp(N, cofactor) >= 0 && mpz_divisible_p(N, cofactor));
+			break;
+
+		default: {
+			mpz_t gcd;
+
+			cofactor = table_cofactor(index);
+
+			mpz_init(gcd);
+			mpz_gcd(gcd, N, cofactor);
+			ret = (mpz_cmp_ui(gcd, 1) > 0);
+
+			/* free mem */
+			mpz_clear(gcd);
+		}
+	}
+
+	return ret;
+}
+
+
+/*
+ * cpseudo_ramifies_gcd(N, l): cpseudo_ramifies() by a gcd with the whole discriminant,
+ *                             the reference for the factored tables
+ */
+unsigned int cpseudo_ramifies_gcd(mpz_t N, unsigned int l)
+{
+	/* sanity check */
+	if ( !N ) return -1;
+
+	/* prime powers are not in the tables */
+	if ( !is_tabulated_prime(l) ) {
+		return cpseudo_ramifies_pp(N, l);
+	}
+
+	mpz_t gcd;
+	int ret = 0;
+	unsigned int index = table_index(l);
+	mpz_srcptr disc = table_discriminant(index);
 
-	mpz_init(disc);
 	mpz_init(gcd);
 
-	mpz_set_str(disc, discriminants[index], 10);
+	if ( disc ) {
 
 #ifdef DEBUG
-	gmp_printf("check: N=%Zd, disc=%Zd, l=%d, index=%d.\n", N, disc, l, index);
+		gmp_printf("check: N=%Zd, disc=%Zd, l=%d, index=%d.\n", N, disc, l, index);
 #endif
 
+		mpz_gcd(gcd, N, disc);
+
+	} else {
+
+		/*
+		 * beyond the static tables disc = (4^l + 1)/5 is prime to 5 (l != 5), so
+		 * gcd(N, disc) = gcd(N', 4^l + 1 mod N') with N' the part of N prime to 5
+		 */
+		mpz_t Np;
+		mpz_init(Np);
+
+		mpz_set_ui(gcd, 5);
+		mpz_remove(Np, N, gcd);
+
+		mpz_set_ui(gcd, 4);
+		mpz_powm_ui(gcd, gcd, l, Np);
+		mpz_add_ui(gcd, gcd, 1);
+		mpz_gcd(gcd, Np, gcd);
+
+		mpz_clear(Np);
+	}
+
+	if (mpz_cmp_ui(gcd, 1) > 0) {
+		ret = 1;
+	}
+
+	/* free mem */
+	mpz_clear(gcd);
+
+	return ret;
+}
+
+
+/*
+ * cpseudo_ramifies_batch(ramify, N, count, l): cpseudo_ramifies() of count numbers N[i]
+ *
+ * a discriminant larger than the N[i] is reduced by their remainder tree, instead of
+ * once per N[i]
+ *
+ * return: 0 on success, -1 otherwise
+ */
+int cpseudo_ramifies_batch(unsigned int *ramify, mpz_t *N, unsigned int count, unsigned int l)
+{
+	unsigned int i;
+	int index = table_index(l);
+	mpz_srcptr disc = (index >= 0) ? table_discriminant(index) : NULL;
+	mpz_srcptr *moduli;
+	size_t bits = 0;
+
+	/* sanity check */
+	if (!ramify || !N) return -1;
+
+	for (i = 0; i < count; i++) {
+		if (mpz_sizeinbase(N[i], 2) > bits) { bits = mpz_sizeinbase(N[i], 2); }
+	}
+
+	/* one by one: no tabulated discriminant, or no gain */
+	if (!disc || count < 2 || mpz_sizeinbase(disc, 2) <= bits) {
+
+		for (i = 0; i < count; i++) {
+			ramify[i] = cpseudo_ramifies(N[i], l);
+		}
+
+		return 0;
+	}
+
+	moduli = malloc(count * sizeof(mpz_srcptr));
+	if (!moduli) return -1;
+
+	for (i = 0; i < count; i++) {
+		moduli[i] = N[i];
+	}
+
+	i = remtree_gcds(ramify, disc, moduli, count);
+
+	/* free mem */
+	free(moduli);
+
+	return i;
+}
+
+
+/*
+ * cpseudo_ramifies_list(ramify, N, ls, count): cpseudo_ramifies() of N for count moduli ls[i]
+ *
+ * an N larger than the product of the tabulated discriminants is reduced by their
+ * remainder tree, instead of once per discriminant
+ *
+ * return: 0 on success, -1 otherwise
+ */
+int cpseudo_ramifies_list(unsigned int *ramify, mpz_t N, unsigned int *ls, unsigned int count)
+{
+	unsigned int i, k = 0;
+	unsigned int *shared, *at;
+	mpz_srcptr *moduli;
+	size_t bits = 0;
+
+	/* sanity check */
+	if (!ramify || !N || !ls) return -1;
+
+	moduli = malloc(count * sizeof(mpz_srcptr));
+	shared = malloc(count * sizeof(unsigned int));
+	at = malloc(count * sizeof(unsigned int));
+
+	if (!moduli || !shared || !at) {
+		free(moduli);
+		free(shared);
+		free(at);
+		return -1;
+	}
+
+	/* the tabulated discriminants go to the tree, the others are checked one by one */
+	for (i = 0; i < count; i++) {
+
+		int index = table_index(ls[i]);
+		mpz_srcptr disc = (index >= 0) ? table_discriminant(index) : NULL;
+
+		if ( disc ) {
+			moduli[k] = disc;
+			at[k] = i;
+			bits += mpz_sizeinbase(disc, 2);
+			k++;
+		} else {
+			ramify[i] = cpseudo_ramifies(N, ls[i]);
+		}
+	}
+
+	/* one by one also if the tree fails */
+	if (k >= 2 && mpz_sizeinbase(N, 2) >= bits && remtree_gcds(shared, N, moduli, k) == 0) {
+
+		for (i = 0; i < k; i++) {
+			ramify[at[i]] = shared[i];
+		}
+
+	} else {
+
+		for (i = 0; i < k; i++) {
+			ramify[at[i]] = cpseudo_ramifies(N, ls[at[i]]);
+		}
+	}
+
+	/* free mem */
+	free(moduli);
+	free(shared);
+	free(at);
+
+	return 0;
+}
+
+
+/*
+ * cpseudo_ramifies_pp(N, q): cpseudo_ramifies() for a prime power q, the
+ *                            discriminant is computed at runtime
+ */
+unsigned int cpseudo_ramifies_pp(mpz_t N, unsigned int q)
+{
+	/* sanity check */
+	if ( !N ) return -1;
+
+	mpz_t disc, gcd;
+	int ret = 0;
+
+	mpz_init(disc);
+	mpz_init(gcd);
+
+	cpseudo_discriminant(disc, q);
+
 	mpz_gcd(gcd, N, disc);
 	if (mpz_cmp_ui(gcd, 1) > 0) {
 		ret = 1;
@@ -130,12 +521,46 @@ unsigned int cpseudo_ramifies(mpz_t N, unsigned int l)
 
 /*
  *  cpseudo_fibo(): test if N is a l-Cyclotomic Fibonacci pseudoprime
- *					where l is a prime number
+ *					where l is a prime number, or a prime power with CPSEUDO_PHI
  *
  *                    U_{N^2(l-1)-1} == 0 (mod N)
  *
+ *					the exponent N^(2f) is applied as 2f successive Nth powers.
+ *					With CPSEUDO_EARLY_ABORT, after each of them Q^(N^j) is checked to
+ *					have trace zeta^(N^j), as it must for N prime (the Frobenius acts as
+ *					zeta -> zeta^N), and N is rejected as soon as this fails.
+ *					With CPSEUDO_PHI, elements are represented modulo Phi_l and the
+ *					dropped x-1 component is left to cpseudo_fibo_scalar(): both pass
+ *					iff the test modulo x^l - 1 passes (l prime to N).
+ *
+ *					The computation cannot descend to the subring of Gaussian periods
+ *					fixed by zeta -> zeta^N, even when f is small: Q contains zeta
+ *					itself, and U_k(zeta) is an odd or even polynomial in zeta, so its
+ *					entries only lie in Z[zeta^2] = Z[zeta].
  */
-int cpseudo_fibo(unsigned int *result, mpz_t N, unsigned int l, unsigned int verbose)
+int cpseudo_fibo(
+	unsigned int *result,
+	mpz_t N,
+	unsigned int l,
+	unsigned int options,
+	unsigned int verbose)
+{
+	return cpseudo_fibo_checkpoint(result, N, l, options, verbose, NULL);
+}
+
+
+/*
+ *  cpseudo_fibo_checkpoint(): cpseudo_fibo() saving its state to ckpt, and resuming
+ *					from the stage and bit of N loaded in ckpt if they are of l
+ *					(CPSEUDO_EARLY_ABORT only)
+ */
+int cpseudo_fibo_checkpoint(
+	unsigned int *result,
+	mpz_t N,
+	unsigned int l,
+	unsigned int options,
+	unsigned int verbose,
+	struct checkpoint *ckpt)
 {
 	/* sanity check */
 	if (!result || !N) return -1;
@@ -146,7 +571,7 @@ int cpseudo_fibo(unsigned int *result, mpz_t N, unsigned int l, unsigned int ver
 	mpz_t L;
 	mpz_init(L);
 	mpz_set_ui(L, l);
-	if (mpz_probab_prime_p(L, 15) == 0) {
+	if (mpz_probab_prime_p(L, 15) == 0 && mpz_perfect_power_p(L) == 0) {
 		return -1;
 	}
 	mpz_clear(L);
@@ -167,38 +592,283 @@ int cpseudo_fibo(unsigned int *result, mpz_t N, unsigned int l, unsigned int ver
 
 	exp = 2 * f;
 
-	mpz_t N_exp;
-	struct cmatrix matrix_N;
+	unsigned int ring = CYCLO_RING_CYCLIC;
 
-	mpz_init(N_exp);
+	/* ASSERT: with CPSEUDO_PHI the x-1 component is checked by cpseudo_fibo_scalar() */
+	if (options & CPSEUDO_PHI) {
+		ring = CYCLO_RING_PHI;
+	}
 
-	mpz_pow_ui(N_exp, N, exp);
+	struct cmatrix matrix_N;
+	struct cmatrix_workspace ws;
 
-	ret = cmatrix_init(&matrix_N, l);
+	ret = cmatrix_init(&matrix_N, l, ring);
 	if ( ret ) { return -1; }
 
-	ret = cmatrix_power(&matrix_N, &matrix_N, N_exp, N);
+	/* scratch buffers for the whole exponentiation */
+	ret = cmatrix_workspace_init(&ws, l, ring, N);
 	if ( ret ) { return -1; }
 
-	struct cyclo U_N_m1;
+	if (options & CPSEUDO_GERBICZ) {
+		ret = cmatrix_workspace_gerbicz(&ws, l, ring);
+		if ( ret ) { goto done; }
+	}
+
+	if (options & CPSEUDO_EARLY_ABORT) {
 
-	ret = cyclo_init(&U_N_m1, l);
+		unsigned int stage, first = 1, e = 1, r = mpz_fdiv_ui(N, l);
+
+		/* the stages before a loaded checkpoint passed */
+		if (ckpt && ckpt->pending && ckpt->pending_l == l && ckpt->pending_stage <= exp) {
+
+			first = ckpt->pending_stage;
+
+			for (stage = 1; stage < first; stage++) {
+				e = (e * r) % l;
+			}
+
+			if ( verbose ) {
+				printf("Resuming stage %d of %d at bit %lu.\n", first, exp,
+						(unsigned long) ckpt->pending_bit);
+			}
+		}
+
+		ws.checkpoint = ckpt;
+
+		/* raise to the Nth power 2f times, checking each intermediate stage */
+		for (stage = first; stage <= exp; stage++) {
+
+			if ( ckpt ) {
+				ckpt->l = l;
+				ckpt->stage = stage;
+			}
+
+			/* -1 also when CPSEUDO_GERBICZ gives up */
+			ret = cmatrix_power(&matrix_N, &matrix_N, N, N, &ws);
+			if ( ret ) { goto done; }
+
+			/* e = N^stage (mod l) */
+			e = (e * r) % l;
+
+			if ( !trace_is_zeta_power(&matrix_N, e, N) ) {
+
+				if ( verbose ) {
+					printf("Rejected at stage %d of %d.\n", stage, exp);
+				}
+
+				goto done;
+			}
+		}
+
+	} else {
+
+		/* raise to the Nth power 2f times instead of materializing N^(2f) */
+		ret = cmatrix_power_iter(&matrix_N, &matrix_N, N, exp, N, &ws);
+		if ( ret ) { goto done; }
+	}
+
+#ifdef DEBUG
+	gmp_printf("N=%Zd, exp=%d.\n", N, exp);
+	cmatrix_print(&matrix_N, N);
+#endif
+
+	/* U_{N^2f-1} is the (2,2) element */
+	if (cyclo_is_zero(&(matrix_N.q22)) == 1) {
+		*result = 1;
+	}
+
+done:
+	if (verbose && ws.errors > 0) {
+		printf("%d arithmetic errors detected and rolled back.\n", ws.errors);
+	}
+
+	/* no exponentiation in progress */
+	if ( ckpt ) {
+		ckpt->l = 0;
+	}
+
+	/* free mem */
+	cmatrix_free(&matrix_N);
+	cmatrix_workspace_free(&ws);
+
+	return ret;
+}
+
+
+/*
+ *  cpseudo_fibo_scalar(): test the x = 1 projection of cpseudo_fibo()
+ *
+ *                    F_{N^2f-1} == 0 (mod N)
+ *
+ *					evaluating Z[x]/(x^l - 1) at x = 1 maps Q to the classical
+ *					Fibonacci matrix, so this is a necessary condition for
+ *					cpseudo_fibo() to pass with any l such that N has order f mod l,
+ *					at a tiny fraction of its cost.
+ *					With CPSEUDO_EARLY_ABORT, the Lucas numbers L_(N^j) are checked
+ *					to be 1 after each Nth power, as they must for N prime.
+ */
+int cpseudo_fibo_scalar(
+	unsigned int *result,
+	mpz_t N,
+	unsigned int f,
+	unsigned int options,
+	unsigned int verbose)
+{
+	/* sanity check */
+	if (!result || !N) return -1;
+
+	*result=0;
+
+	unsigned int stage, exp = 2 * f;
+	mp_bitcnt_t i, bits = mpz_sizeinbase(N, 2);
+
+	/* symmetric matrices [[q12 + q22, q12], [q12, q22]] */
+	mpz_t q12, q22, acc12, acc22, pow12, pow22, t12, t22;
+
+	mpz_init_set_ui(q12, 1);
+	mpz_init_set_ui(q22, 0);
+	mpz_init(acc12);
+	mpz_init(acc22);
+	mpz_init(pow12);
+	mpz_init(pow22);
+	mpz_init(t12);
+	mpz_init(t22);
+
+	for (stage = 1; stage <= exp; stage++) {
+
+		/* (q12, q22) = (q12, q22)^N */
+		mpz_set_ui(acc12, 0);
+		mpz_set_ui(acc22, 1);
+		mpz_set(pow12, q12);
+		mpz_set(pow22, q22);
+
+		for (i = 0; i < bits; i++) {
+
+			if (mpz_tstbit(N, i)) {
+				scalar_mult(acc12, acc22, acc12, acc22, pow12, pow22, N, t12, t22);
+			}
+
+			if (i + 1 < bits) {
+				scalar_mult(pow12, pow22, pow12, pow22, pow12, pow22, N, t12, t22);
+			}
+		}
+
+		mpz_set(q12, acc12);
+		mpz_set(q22, acc22);
+
+		if (options & CPSEUDO_EARLY_ABORT) {
+
+			/* trace = L_(N^stage) */
+			mpz_add(t12, q12, q22);
+			mpz_add(t12, t12, q22);
+			mpz_mod(t12, t12, N);
+
+			if (mpz_cmp_ui(t12, 1) != 0) {
+
+				if ( verbose ) {
+					printf("Scalar test rejected at stage %d of %d.\n", stage, exp);
+				}
+
+				goto done;
+			}
+		}
+	}
+
+	/* F_{N^2f-1} */
+	if (mpz_sgn(q22) == 0) {
+		*result = 1;
+	}
+
+done:
+	/* free mem */
+	mpz_clear(q12);
+	mpz_clear(q22);
+	mpz_clear(acc12);
+	mpz_clear(acc22);
+	mpz_clear(pow12);
+	mpz_clear(pow22);
+	mpz_clear(t12);
+	mpz_clear(t22);
+
+	return 0;
+}
+
+
+/*
+ *  cpseudo_frobenius(): test if N is a l-Cyclotomic Frobenius pseudoprime
+ *					where l is a prime number
+ *
+ *                    U_{N+1} + U_{N-1} == zeta^N (mod N)
+ *
+ *					for N prime, raising to the Nth power acts on O(zeta_l)/N as the
+ *					Frobenius automorphism zeta -> zeta^N, so the trace of Q^N must be
+ *					the Frobenius conjugate of the trace of Q, which is zeta.
+ *					Requires a single Nth power instead of 2f of them.
+ */
+int cpseudo_frobenius(unsigned int *result, mpz_t N, unsigned int l, unsigned int verbose)
+{
+	/* sanity check */
+	if (!result || !N) return -1;
+
+	/* ASSERT: l is a prime number, checked by the caller */
+	/* ASSERT: N does not ramifies in O(zeta_l), checked by the caller */
+
+	*result=0;
+
+	int ret = 0;
+
+	struct cmatrix matrix_N;
+	struct cmatrix_workspace ws;
+
+	ret = cmatrix_init(&matrix_N, l, CYCLO_RING_CYCLIC);
 	if ( ret ) { return -1; }
 
-	ret = cmatrix_getvalue_22(&U_N_m1, &matrix_N);
+	ret = cmatrix_workspace_init(&ws, l, CYCLO_RING_CYCLIC, N);
 	if ( ret ) { return -1; }
 
+	ret = cmatrix_power(&matrix_N, &matrix_N, N, N, &ws);
+	if ( ret ) { return -1; }
+
+	cmatrix_workspace_free(&ws);
+
+	struct cyclo trace, zeta, zeta_N;
+
+	cyclo_init(&trace, l);
+	cyclo_init(&zeta, l);
+	cyclo_init(&zeta_N, l);
+
+	/* trace of Q^N: U_{N+1} + U_{N-1} */
+	cmatrix_getvalue_11(&trace, &matrix_N, N);
+	cyclo_add(&trace, &trace, &(matrix_N.q22), N, NULL);
+
+	/* Frobenius conjugate of the trace of Q: zeta -> zeta^N */
+	mpz_t value;
+	mpz_init_set_ui(value, 1);
+
+	cyclo_set_coord(&zeta, value, 1);
+	cyclo_frobenius(&zeta_N, &zeta, N);
+
+	mpz_clear(value);
+
 #ifdef DEBUG
-	gmp_printf("N=%Zd, exp=%d, N_exp=%Zd.\n", N, exp, N_exp);
-	cmatrix_print(&matrix_N);
-/*	cyclo_print(&U_N_m1);*/
+	cmatrix_print(&matrix_N, N);
+	cyclo_print(&trace);
+	printf("\n");
 #endif
 
-	if (cyclo_is_zero(&U_N_m1) == 1) {
+	if (cyclo_is_equal(&trace, &zeta_N) == 1) {
 		*result = 1;
 	}
 
-	cyclo_free(&U_N_m1);	/* free mem */
+	if ( verbose ) {
+		printf("Frobenius congruence %s.\n", *result ? "holds" : "fails");
+	}
+
+	/* free mem */
+	cyclo_free(&trace);
+	cyclo_free(&zeta);
+	cyclo_free(&zeta_N);
+	cmatrix_free(&matrix_N);
 
 	return ret;
 }
@@ -216,7 +886,7 @@ int cpseudo_test()
 	mpz_init(N);
 	mpz_set_ui(N, 11);
 
-	cpseudo_fibo(&result, N, l, 0);
+	cpseudo_fibo(&result, N, l, 0, 0);
 
 	mpz_clear(N);
 
@@ -29,32 +29,68 @@
 
 
 /* Constants */
-#define MAXPHIDIVISORS	40
+#define MAXPHIDIVISORSTOTAL	7663	/* sum of the counts, size of phi_divisors[] */
 #define MAXPRIMEINDEX	563
 #define MAXPRIME		4093
 
+#define DISCFACTORSTOTAL	747	/* size of disc_factors[], see print_disc_factors() */
+#define DISCFACTORBOUND	(1U << 24)	/* trial division bound of print_disc_factors() */
+
+/* what is left of discriminants[i] once disc_factors[] are removed */
+#define DISC_COFACTOR_ONE		0
+#define DISC_COFACTOR_PRIME		1
+#define DISC_COFACTOR_COMPOSITE	2
+
+/* the static tables above are extended at runtime up to these, see table_prime() */
+#define MAXTABLEINDEX	6542
+#define MAXTABLEPRIME	65537	/* = CYCLO_MAX_SIZE */
+
+/* cpseudo_fibo() options */
+#define CPSEUDO_EARLY_ABORT	0x01	/* reject at the first intermediate stage that fails */
+#define CPSEUDO_PHI			0x02	/* work modulo Phi_l, see cpseudo_fibo_scalar() */
+#define CPSEUDO_GERBICZ		0x04	/* detect and roll back arithmetic errors, see cmatrix.c */
+
 
 /* Structures Declarations */
-struct divisors_list {
-	unsigned int divisors[MAXPRIME];
-	unsigned int count;
-};
+struct checkpoint;		/* see checkpoint.h */
 
 
 /* Globals */
 extern int			 		prime_to_index[MAXPRIME+1];
 extern unsigned int			primes[MAXPRIMEINDEX];
-extern struct divisors_list phi_divisors[MAXPRIMEINDEX];
+extern unsigned int			phi_divisors[MAXPHIDIVISORSTOTAL];
+extern unsigned int			phi_divisors_offset[MAXPRIMEINDEX+1];
+extern unsigned int			disc_factors[DISCFACTORSTOTAL];
+extern unsigned int			disc_factors_offset[MAXPRIMEINDEX+1];
+extern unsigned char		disc_cofactors[MAXPRIMEINDEX];
 
 
 /* Functions Declarations */
-int cpseudo_fibo    (unsigned int *, mpz_t, unsigned int, unsigned int);
+int cpseudo_fibo    (unsigned int *, mpz_t, unsigned int, unsigned int, unsigned int);
+int cpseudo_fibo_checkpoint(unsigned int *, mpz_t, unsigned int, unsigned int, unsigned int,
+		struct checkpoint *);
+int cpseudo_fibo_scalar(unsigned int *, mpz_t, unsigned int, unsigned int, unsigned int);
+int cpseudo_frobenius(unsigned int *, mpz_t, unsigned int, unsigned int);
 
 unsigned int smallest_exp(mpz_t, unsigned int);
+unsigned int smallest_exp_pp(mpz_t, unsigned int);
 unsigned int cpseudo_ramifies(mpz_t, unsigned int);
+unsigned int cpseudo_ramifies_gcd(mpz_t, unsigned int);
+int cpseudo_ramifies_batch(unsigned int *, mpz_t *, unsigned int, unsigned int);
+int cpseudo_ramifies_list(unsigned int *, mpz_t, unsigned int *, unsigned int);
+unsigned int cpseudo_ramifies_pp(mpz_t, unsigned int);
+void cpseudo_discriminant(mpz_t, unsigned int);
+
+unsigned int table_prime(unsigned int);
+int table_index(unsigned int);
+unsigned int table_divisors(unsigned int, const unsigned int **);
+mpz_srcptr table_discriminant(unsigned int);
+mpz_srcptr table_cofactor(unsigned int);
+unsigned int table_verify_factors(unsigned int);
 
 void print_phi_divisors();
 void print_prime_to_index();
+void print_disc_factors();
 
 int cpseudo_print_list(unsigned int);
 
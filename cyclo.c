@@ -22,26 +22,96 @@
 
 /* Includes */
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "cyclo.h"
-#include "flint/fmpz.h"
-#include "flint/fmpz_poly.h"
+
+
+/* private functions */
+
+/*
+ *  cyclo_stride(): s = q/p for the prime power q = p^k
+ */
+static unsigned int cyclo_stride(unsigned int q)
+{
+	unsigned int p;
+
+	/* smallest prime factor of q */
+	for (p = 2; p * p <= q; p++) {
+		if ((q % p) == 0) { break; }
+	}
+
+	if (p * p > q) { p = q; }
+
+	return q / p;
+}
+
+
+/*
+ *  cyclo_add_monomial(): add c * x^m, m < q, to number (modulo Phi_q in the Phi ring)
+ */
+static void cyclo_add_monomial(struct cyclo *number, mpz_t c, unsigned int m, unsigned int stride)
+{
+	unsigned int j;
+
+	if (m < number->size) {
+		mpz_add(number->values[m], number->values[m], c);
+		return;
+	}
+
+	/* x^((p-1)s + t) = -(x^t + x^(s+t) + ... + x^((p-2)s+t)) */
+	for (j = m - number->size; j < number->size; j += stride) {
+		mpz_sub(number->values[j], number->values[j], c);
+	}
+}
 
 
 /* public functions */
 
 /*
- *  cyclo_init(): initialization function
+ *  cyclo_ring_size(): number of coordinates of an element of O(zeta_q)
+ *                     in the given ring representation
+ */
+unsigned int cyclo_ring_size(unsigned int q, unsigned int ring)
+{
+	if (ring == CYCLO_RING_PHI) {
+		return q - cyclo_stride(q);
+	}
+
+	return q;
+}
+
+
+/*
+ *  cyclo_init(): initialization function, in the ring Z[x]/(x^size - 1)
  */
 int cyclo_init(struct cyclo *number, unsigned int size)
+{
+	return cyclo_init_ring(number, size, CYCLO_RING_CYCLIC);
+}
+
+
+/*
+ *  cyclo_init_ring(): initialization function, for O(zeta_q) in the given ring
+ *                     representation
+ */
+int cyclo_init_ring(struct cyclo *number, unsigned int q, unsigned int ring)
 {
 	/* sanity check */
 	if (!number) return -1;
 
-	/* check static bounds */
+	unsigned int size = cyclo_ring_size(q, ring);
+
+	/* check bounds */
 	if (size > CYCLO_MAX_SIZE || size == 0) return -1;
 
 	/* initialize elements */
 	number->size = size;
+	number->order = q;
+	number->ring = ring;
+
+	number->values = malloc(size * sizeof(mpz_t));
+	if ( !number->values ) return -1;
 
 	unsigned int i;
 	for (i = 0; i < size; i++) {
@@ -52,6 +122,36 @@ int cyclo_init(struct cyclo *number, unsigned int size)
 }
 
 
+/*
+ *  cyclo_init2(): initialization function, reserving room for bits-wide coordinates
+ */
+int cyclo_init2(struct cyclo *number, unsigned int q, unsigned int ring, mp_bitcnt_t bits)
+{
+	/* sanity check */
+	if (!number) return -1;
+
+	unsigned int size = cyclo_ring_size(q, ring);
+
+	/* check bounds */
+	if (size > CYCLO_MAX_SIZE || size == 0) return -1;
+
+	/* initialize elements */
+	number->size = size;
+	number->order = q;
+	number->ring = ring;
+
+	number->values = malloc(size * sizeof(mpz_t));
+	if ( !number->values ) return -1;
+
+	unsigned int i;
+	for (i = 0; i < size; i++) {
+		mpz_init2(number->values[i], bits);
+	}
+
+	return 0;
+}
+
+
 /*
  * cyclo_free(): free memory
  */
@@ -66,6 +166,8 @@ int cyclo_free(struct cyclo *number)
 		mpz_clear(number->values[i]);
 	}
 
+	free(number->values);
+
 	return 0;
 }
 
@@ -163,81 +265,162 @@ int cyclo_set_coord(struct cyclo *number, mpz_t value, unsigned int i)
 }
 
 
+/*
+ *  cyclo_set_zeta_power(): set number to zeta^e modulo N
+ */
+int cyclo_set_zeta_power(struct cyclo *number, unsigned int e, mpz_t N)
+{
+	/* sanity check */
+	if (!number || !N) return -1;
+
+	unsigned int i;
+	mpz_t one;
+
+	mpz_init_set_ui(one, 1);
+
+	cyclo_zero(number);
+	cyclo_add_monomial(number, one, e % number->order, cyclo_stride(number->order));
+
+	for (i = 0; i < number->size; i++) {
+		mpz_mod(number->values[i], number->values[i], N);
+	}
+
+	mpz_clear(one);
+
+	return 0;
+}
+
+
 /*
  *  cyclo_mult(): multiply 2 algebraic integers in O(zeta_l) modulo N
+ *
+ *  coordinates are not reduced modulo N, see cyclo_add()
  */
 int cyclo_mult(
 	struct cyclo *result,
 	struct cyclo *n1,
 	struct cyclo *n2,
-	mpz_t N)
+	mpz_t N,
+	struct cyclo_workspace *ws)
 {
-	unsigned int ret = 0;
-	struct cyclo r;
-
 	/* sanity check */
-	if (!result || !n1 || !n2 || !N) return -1;
+	if (!result || !n1 || !n2 || !N || !ws) return -1;
 
-	/* ASSERT: n1->size == n2->size == result->size, checked by the caller */
-	unsigned int i, size;
+	/* ASSERT: n1 n2 and result share size and ring, size == ws->size, checked by the caller */
+	unsigned int i, size, q, stride;
 	size = n1->size;
+	q = n1->order;
+	stride = cyclo_stride(q);
 
-	/* initialize local variables */
-	ret = cyclo_init(&r, size);
-
-	if ( ret ) { return -1; }
-
-	fmpz_poly_t n1_poly, n2_poly, r_poly;
-
-	/* allocate polynomials */
-	fmpz_poly_init2(n1_poly, size);
-	fmpz_poly_init2(n2_poly, size);
-	fmpz_poly_init2(r_poly,  size * 2);
-
-	/* convert n1 and n2 into nmod_poly_t */
-	fmpz_t ftmp;
-	fmpz_init(ftmp);
+	/* convert n1 and n2 into fmpz_poly_t */
 	for (i = 0; i < size; i++) {
 
-		fmpz_set_mpz(ftmp, n1->values[i]);
-		fmpz_poly_set_coeff_fmpz(n1_poly, i, ftmp);
+		fmpz_set_mpz(ws->ftmp, n1->values[i]);
+		fmpz_poly_set_coeff_fmpz(ws->n1_poly, i, ws->ftmp);
 
-		fmpz_set_mpz(ftmp, n2->values[i]);
-		fmpz_poly_set_coeff_fmpz(n2_poly, i, ftmp);
+		fmpz_set_mpz(ws->ftmp, n2->values[i]);
+		fmpz_poly_set_coeff_fmpz(ws->n2_poly, i, ws->ftmp);
 	}
 
 	/* multiply n1_poly and n2_poly */
-	fmpz_poly_mul(r_poly, n1_poly, n2_poly);
+	fmpz_poly_mul(ws->r_poly, ws->n1_poly, ws->n2_poly);
 
 	/* convert back r_poly into a cyclotomic integer (collapse equivalent powers) */
-	mpz_t tmp;
-	mpz_init(tmp);
+	/* n1 and n2 are no longer needed, so result may alias them */
+	cyclo_zero(result);
+
 	for (i = 0; i < 2*size; i++) {
 
-		fmpz_poly_get_coeff_fmpz(ftmp, r_poly, i);
-		fmpz_get_mpz(tmp, ftmp);
-		mpz_add(r.values[i%size], r.values[i%size], tmp);
+		fmpz_poly_get_coeff_fmpz(ws->ftmp, ws->r_poly, i);
+		fmpz_get_mpz(ws->tmp, ws->ftmp);
+
+		if (mpz_sgn(ws->tmp) != 0) {
+			cyclo_add_monomial(result, ws->tmp, i % q, stride);
+		}
 	}
 
-	/* free mem */
-	fmpz_poly_clear(n1_poly);
-	fmpz_poly_clear(n2_poly);
-	fmpz_poly_clear(r_poly);
-	fmpz_clear(ftmp);
-	mpz_clear(tmp);
+	return 0;
+}
 
-	/* copy result */
-	cyclo_copy(result, &r);
 
-	/* free memory */
-	cyclo_free(&r);
+/*
+ *  cyclo_pack(): Kronecker substitution, packed = sum values[i] 2^(64 slot i)
+ *
+ *  with coordinates in [0, 2^(64 slot)) the slots never overlap, so a product of
+ *  packed integers holds the coefficients of the polynomial product as long as
+ *  they fit in a slot, see cyclo_unpack()
+ */
+int cyclo_pack(mpz_t packed, struct cyclo *number, mp_size_t slot)
+{
+	/* sanity check */
+	if (!packed || !number || slot == 0) return -1;
 
-	return ret;
+	unsigned int i;
+	mp_size_t total = slot * number->size;
+	mp_limb_t *p = mpz_limbs_write(packed, total);
+
+	/* ASSERT: 0 <= values[i] < 2^(GMP_NUMB_BITS slot), checked by the caller */
+	for (i = 0; i < number->size; i++) {
+
+		mp_size_t n = mpz_size(number->values[i]);
+
+		memcpy(p + i * slot, mpz_limbs_read(number->values[i]), n * sizeof(mp_limb_t));
+		memset(p + i * slot + n, 0, (slot - n) * sizeof(mp_limb_t));
+	}
+
+	mpz_limbs_finish(packed, total);
+
+	return 0;
 }
 
 
 /*
- *  cyclo_mult_by_zeta(): multiply by zeta an algebraic integers in O(zeta_l) modulo N
+ *  cyclo_unpack(): read back the polynomial product of packed integers, fold it like
+ *                  cyclo_mult() and reduce modulo N
+ */
+int cyclo_unpack(
+	struct cyclo *result,
+	mpz_t packed,
+	mp_size_t slot,
+	mpz_t N,
+	struct cyclo_workspace *ws)
+{
+	/* sanity check */
+	if (!result || !packed || slot == 0 || !N || !ws) return -1;
+
+	unsigned int i, stride = cyclo_stride(result->order);
+	mp_size_t total = mpz_size(packed);
+	const mp_limb_t *p = mpz_limbs_read(packed);
+
+	cyclo_zero(result);
+
+	for (i = 0; (mp_size_t) i * slot < total; i++) {
+
+		mp_size_t n = total - i * slot;
+
+		if (n > slot) { n = slot; }
+
+		/* strip the zero high limbs of the slot */
+		while (n > 0 && p[i * slot + n - 1] == 0) { n--; }
+
+		if (n == 0) { continue; }
+
+		memcpy(mpz_limbs_write(ws->tmp, n), p + i * slot, n * sizeof(mp_limb_t));
+		mpz_limbs_finish(ws->tmp, n);
+
+		cyclo_add_monomial(result, ws->tmp, i % result->order, stride);
+	}
+
+	for (i = 0; i < result->size; i++) {
+		cyclo_mod(result->values[i], result->values[i], N, ws);
+	}
+
+	return 0;
+}
+
+
+/*
+ *  cyclo_mult_by_zeta(): multiply by zeta an algebraic integers in O(zeta_q) modulo N
  */
 int cyclo_mult_by_zeta(
 	struct cyclo *result,
@@ -248,10 +431,24 @@ int cyclo_mult_by_zeta(
 	/* sanity check */
 	if (!result || !n) return -1;
 
-	/* ASSERT: n->size == result->size, checked by the caller */
+	/* ASSERT: n and result share size and ring and are distinct, checked by the caller */
 	unsigned int i, size;
 	size = n->size;
 
+	if (n->ring == CYCLO_RING_PHI) {
+
+		/* zeta^((p-1)s) = -(1 + zeta^s + ... + zeta^((p-2)s)) */
+		mpz_set_ui(result->values[0], 0);
+
+		for (i = 1; i < size; i++) {
+			mpz_set(result->values[i], n->values[i-1]);
+		}
+
+		cyclo_add_monomial(result, n->values[size-1], size, cyclo_stride(n->order));
+
+		return ret;
+	}
+
 	for (i = 0; i < size; i++) {
 		mpz_set(result->values[ (i+1) % size ], n->values[i]);
 	}
@@ -261,34 +458,42 @@ int cyclo_mult_by_zeta(
 
 
 /*
- *  cyclo_add(): sum two algebraic integers in O(zeta_l) modulo N
+ *  cyclo_frobenius(): apply the automorphism zeta -> zeta^N to an algebraic integer
+ *
+ *  the coefficient of zeta^i is moved to zeta^(i*N mod q), which is a permutation
+ *  of the coordinates when p does not divide N; coordinates are reduced modulo N
  */
-int cyclo_add(
+int cyclo_frobenius(
 	struct cyclo *result,
-	struct cyclo *n1,
-	struct cyclo *n2,
+	struct cyclo *n,
 	mpz_t N)
 {
 	/* sanity check */
-	if (!result || !n1 || !n2 || !N) return -1;
+	if (!result || !n || !N) return -1;
 
 	int ret = 0;
-	unsigned int size = n1->size;
+	unsigned int size = n->size;
+	unsigned int q = n->order;
 	struct cyclo r;
 
 	/* initialize local variables */
-	ret = cyclo_init(&r, size);
+	ret = cyclo_init_ring(&r, q, n->ring);
 	if ( ret ) { return -1; }
 
-	/* ASSERT: n1->size == n2->size == result->size, checked by the caller */
-	unsigned int i;
+	/* ASSERT: n and result share size and ring, checked by the caller */
+	unsigned int i, shift, stride;
+	shift = mpz_fdiv_ui(N, q);
+	stride = cyclo_stride(q);
+
 	for (i = 0; i < size; i++) {
-		mpz_add(r.values[i], n1->values[i], n2->values[i]);
-		mpz_mod(r.values[i], r.values[i], N);
+		unsigned int j = (unsigned int) (((unsigned long) i * shift) % q);
+		cyclo_add_monomial(&r, n->values[i], j, stride);
 	}
 
 	/* copy result */
-	cyclo_copy(result, &r);
+	for (i = 0; i < size; i++) {
+		mpz_mod(result->values[i], r.values[i], N);
+	}
 
 	/* free mem */
 	cyclo_free(&r);
@@ -297,6 +502,173 @@ int cyclo_add(
 }
 
 
+/*
+ *  cyclo_mod(): r = x mod N, 0 <= r < N
+ *
+ *  for N = k*2^n + c, write x = h*2^n + lo and h = k*h' + r': since k*2^n = -c,
+ *  x = r'*2^n + lo - c*h', which drops about n bits per step without a division.
+ *  ws may be NULL, then mpz_mod() is used.
+ */
+int cyclo_mod(mpz_t r, mpz_t x, mpz_t N, struct cyclo_workspace *ws)
+{
+	/* sanity check */
+	if (!r || !x || !N) return -1;
+
+	if (!ws || ws->form == CYCLO_FORM_GENERIC) {
+		mpz_mod(r, x, N);
+		return 0;
+	}
+
+	int sign = 1;
+	mp_bitcnt_t top = ws->n + 2 * (mpz_sizeinbase(N, 2) - ws->n) + 2;
+
+	mpz_set(r, x);
+
+	while (1) {
+
+		unsigned long rk;
+
+		/* keep r >= 0, -r is reduced instead */
+		if (mpz_sgn(r) < 0) {
+			mpz_neg(r, r);
+			sign = -sign;
+		}
+
+		if (mpz_sizeinbase(r, 2) <= top) { break; }
+
+		mpz_tdiv_r_2exp(ws->lo, r, ws->n);
+		mpz_tdiv_q_2exp(ws->hi, r, ws->n);
+
+		/* h = k*h' + r' */
+		rk = mpz_tdiv_q_ui(ws->hi, ws->hi, ws->k);
+
+		mpz_set_ui(r, rk);
+		mpz_mul_2exp(r, r, ws->n);
+		mpz_add(r, r, ws->lo);
+
+		if (ws->c < 0) {
+			mpz_add(r, r, ws->hi);
+		} else {
+			mpz_sub(r, r, ws->hi);
+		}
+	}
+
+	/* ASSERT: r is now a few bits longer than N */
+	mpz_mod(r, r, N);
+
+	if (sign < 0 && mpz_sgn(r) != 0) {
+		mpz_sub(r, N, r);
+	}
+
+	return 0;
+}
+
+
+/*
+ *  cyclo_add(): sum two algebraic integers in O(zeta_l) modulo N
+ *
+ *  ws may be NULL, see cyclo_mod()
+ */
+int cyclo_add(
+	struct cyclo *result,
+	struct cyclo *n1,
+	struct cyclo *n2,
+	mpz_t N,
+	struct cyclo_workspace *ws)
+{
+	/* sanity check */
+	if (!result || !n1 || !n2 || !N) return -1;
+
+	unsigned int size = n1->size;
+
+	/* ASSERT: n1->size == n2->size == result->size, checked by the caller */
+	/* coordinates are summed one by one, so result may alias n1 or n2 */
+	unsigned int i;
+	for (i = 0; i < size; i++) {
+		mpz_add(result->values[i], n1->values[i], n2->values[i]);
+		cyclo_mod(result->values[i], result->values[i], N, ws);
+	}
+
+	return 0;
+}
+
+
+/*
+ *  cyclo_workspace_init(): allocate the scratch buffers of cyclo_mult() for the
+ *                          given size and modulus N
+ */
+int cyclo_workspace_init(struct cyclo_workspace *ws, unsigned int size, mpz_t N)
+{
+	/* sanity check */
+	if (!ws || !N) return -1;
+
+	/* check bounds */
+	if (size > CYCLO_MAX_SIZE || size == 0) return -1;
+
+	ws->size = size;
+
+	/* a product coordinate is a sum of at most 2*size products of reduced coordinates */
+	mp_bitcnt_t bits = 2 * mpz_sizeinbase(N, 2) + 32;
+
+	fmpz_poly_init2(ws->n1_poly, size);
+	fmpz_poly_init2(ws->n2_poly, size);
+	fmpz_poly_init2(ws->r_poly,  size * 2);
+
+	fmpz_init(ws->ftmp);
+	mpz_init2(ws->tmp, bits);
+
+	mpz_init2(ws->hi, bits);
+	mpz_init2(ws->lo, bits);
+
+	/* N = k*2^n + c */
+	ws->form = CYCLO_FORM_GENERIC;
+
+	for (ws->c = 1; ws->c >= -1; ws->c -= 2) {
+
+		if (ws->c > 0) {
+			mpz_sub_ui(ws->lo, N, 1);
+		} else {
+			mpz_add_ui(ws->lo, N, 1);
+		}
+
+		if (mpz_sgn(ws->lo) == 0) { continue; }
+
+		ws->n = mpz_scan1(ws->lo, 0);
+		mpz_tdiv_q_2exp(ws->hi, ws->lo, ws->n);
+
+		if (ws->n >= CYCLO_FORM_MIN_N && mpz_fits_ulong_p(ws->hi)) {
+			ws->k = mpz_get_ui(ws->hi);
+			ws->form = CYCLO_FORM_SPECIAL;
+			break;
+		}
+	}
+
+	return 0;
+}
+
+
+/*
+ * cyclo_workspace_free(): free memory
+ */
+int cyclo_workspace_free(struct cyclo_workspace *ws)
+{
+	/* sanity check */
+	if (!ws) return -1;
+
+	fmpz_poly_clear(ws->n1_poly);
+	fmpz_poly_clear(ws->n2_poly);
+	fmpz_poly_clear(ws->r_poly);
+
+	fmpz_clear(ws->ftmp);
+	mpz_clear(ws->tmp);
+
+	mpz_clear(ws->hi);
+	mpz_clear(ws->lo);
+
+	return 0;
+}
+
+
 int cyclo_print(struct cyclo *number)
 {
 	/* sanity check */
@@ -325,6 +697,7 @@ int cyclo_test()
 	unsigned int size = 3;
 	mpz_t N, one, two;
 	struct cyclo n1, n2, r;
+	struct cyclo_workspace ws;
 
 	cyclo_init(&n1, size);
 	cyclo_init(&n2, size);
@@ -339,12 +712,14 @@ int cyclo_test()
 	mpz_init(two);
 	mpz_set_ui(two, 2);
 
+	cyclo_workspace_init(&ws, size, N);
+
 	cyclo_set_coord(&n1, one, 0);
 	cyclo_set_coord(&n2, two, 1);
 
 	/*cyclo_copy(&r, &n2);*/
 	/*cyclo_add(&r, &n1, &n2, N);*/
-	cyclo_mult(&r, &n1, &n2, N);
+	cyclo_mult(&r, &n1, &n2, N, &ws);
 
 	cyclo_print(&n1);
 	printf("\n");
@@ -358,6 +733,7 @@ int cyclo_test()
 	cyclo_free(&n1);
 	cyclo_free(&n2);
 	cyclo_free(&r);
+	cyclo_workspace_free(&ws);
 
 	mpz_clear(N);
 
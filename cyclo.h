@@ -26,27 +26,72 @@
 
 /* Includes */
 #include "gmp.h"
+#include "flint/fmpz.h"
+#include "flint/fmpz_poly.h"
 
 
 /* Constants */
-#define CYCLO_MAX_SIZE	4096
+#define CYCLO_MAX_SIZE	65537	/* Z[x]/(x^l - 1) for l = 65537, the largest prime of the tables */
+
+/* rings: representation of O(zeta_q) = Z[x]/(Phi_q), q = p^k a prime power */
+#define CYCLO_RING_CYCLIC	0	/* Z[x]/(x^q - 1), size = q coordinates */
+#define CYCLO_RING_PHI		1	/* Z[x]/(Phi_q), size = phi(q) = q - q/p coordinates */
+
+/* forms of the modulus N, see cyclo_mod() */
+#define CYCLO_FORM_GENERIC	0
+#define CYCLO_FORM_SPECIAL	1	/* N = k*2^n + c, c = +1 or -1, k a word */
+#define CYCLO_FORM_MIN_N	512	/* below, mpz_mod() is as fast */
 
 
 /* Structures Declarations */
 
 /*
- * Represents an algebraic integer in the cyclotomic ring O(zeta_l)
+ * Represents an algebraic integer in the cyclotomic ring O(zeta_q)
+ *
+ * In the CYCLO_RING_CYCLIC representation the extra components of x^q - 1 are
+ * carried along. In the CYCLO_RING_PHI one, with s = q/p,
+ *		Phi_q(x) = 1 + x^s + x^2s + ... + x^(p-1)s
+ * so that zeta^((p-1)s + t) = -(zeta^t + zeta^(s+t) + ... + zeta^((p-2)s+t)):
+ * for q = l prime zeta^(l-1) = -(1 + ... + zeta^(l-2)), for q = 2^k zeta^(q/2) = -1.
  *
  */
 struct cyclo {
 	unsigned int size;
-	mpz_t values[CYCLO_MAX_SIZE];
+	unsigned int order;	/* q */
+	unsigned int ring;
+	mpz_t *values;		/* size coordinates, allocated by the init functions */
+};
+
+
+/*
+ * Scratch buffers for cyclo_mult(), preallocated once for a given size and modulus N
+ * so that repeated multiplications do not allocate
+ *
+ * The form of N is detected once here and used by cyclo_mod().
+ *
+ */
+struct cyclo_workspace {
+	unsigned int size;
+	fmpz_poly_t n1_poly, n2_poly, r_poly;
+	fmpz_t ftmp;
+	mpz_t tmp;
+
+	/* modulus N = k*2^n + c */
+	unsigned int form;
+	unsigned long k;
+	mp_bitcnt_t n;
+	int c;
+	mpz_t hi, lo;
 };
 
 
 /* Functions Declarations */
 
+unsigned int cyclo_ring_size(unsigned int, unsigned int);
+
 int cyclo_init(struct cyclo *, unsigned int);
+int cyclo_init_ring(struct cyclo *, unsigned int, unsigned int);
+int cyclo_init2(struct cyclo *, unsigned int, unsigned int, mp_bitcnt_t);
 int cyclo_free(struct cyclo *);
 
 int cyclo_copy(struct cyclo *, struct cyclo *);
@@ -56,12 +101,21 @@ int cyclo_is_zero(struct cyclo *);
 int cyclo_is_equal(struct cyclo *, struct cyclo *);
 
 int cyclo_set_coord(struct cyclo *, mpz_t, unsigned int);
+int cyclo_set_zeta_power(struct cyclo *, unsigned int, mpz_t);
 
-int cyclo_add (struct cyclo *, struct cyclo *, struct cyclo *, mpz_t);
-int cyclo_mult(struct cyclo *, struct cyclo *, struct cyclo *, mpz_t);
+int cyclo_mod(mpz_t, mpz_t, mpz_t, struct cyclo_workspace *);
+int cyclo_add (struct cyclo *, struct cyclo *, struct cyclo *, mpz_t, struct cyclo_workspace *);
+int cyclo_mult(struct cyclo *, struct cyclo *, struct cyclo *, mpz_t, struct cyclo_workspace *);
 
 int cyclo_mult_by_zeta(struct cyclo *, struct cyclo *n);
 
+int cyclo_pack(mpz_t, struct cyclo *, mp_size_t);
+int cyclo_unpack(struct cyclo *, mpz_t, mp_size_t, mpz_t, struct cyclo_workspace *);
+int cyclo_frobenius(struct cyclo *, struct cyclo *, mpz_t);
+
+int cyclo_workspace_init(struct cyclo_workspace *, unsigned int, mpz_t);
+int cyclo_workspace_free(struct cyclo_workspace *);
+
 int cyclo_print(struct cyclo *);
 
 int cyclo_test();
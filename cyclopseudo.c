@@ -32,6 +32,7 @@
 /* Constants */
 #define DEFAULT_OFFSET	100000
 #define DEFAULT_MIN		3
+#define BATCH_SIZE		1024	/* N checked at once by cpseudo_ramifies_batch() */
 
 
 /* Utility Functions */
@@ -47,6 +48,9 @@ Starts at the integer MIN if specified.\n\
 If MILESTONE is specified, print a progress status at every MILESTONE.\n\
 \n\
 Options:\n\
+     -f: use the Frobenius congruence test (one Nth power) instead of U_{N^2f-1}.\n\
+     -p: represent elements modulo Phi_l instead of x^l - 1.\n\
+     -d: verify the factored discriminant tables and every ramification check.\n\
      -h: print this help.\n");
 
 	exit(1);
@@ -61,12 +65,27 @@ int main(int argc, char **argv)
 	unsigned int l;
 	unsigned int offset = DEFAULT_OFFSET;
 	int min = DEFAULT_MIN;
+	int frobenius = 0;
+	int verify = 0;
+	unsigned int options = 0;
 
 	opterr = 0;
-	while ( (c = getopt(argc, argv, "h")) != -1) {
+	while ( (c = getopt(argc, argv, "fpdh")) != -1) {
 
 		switch (c) {
 
+			case 'f':
+				frobenius = 1;
+				break;
+
+			case 'p':
+				options |= CPSEUDO_PHI;
+				break;
+
+			case 'd':
+				verify = 1;
+				break;
+
 			case 'h':
 				usage("");
 				break;
@@ -111,13 +130,24 @@ int main(int argc, char **argv)
 		}
 	}
 
+	if ( verify && table_verify_factors(1) > 0 ) {
+		printf("Unexpected error.\n");
+		return -1;
+	}
+
 	mpz_t N;
+	mpz_t batch[BATCH_SIZE];
+	unsigned int ramify[BATCH_SIZE];
 
 	mpz_init(N);
 
 	int i;
 	int milestone = (min - (min % offset)) + offset;
 
+	for (i = 0; i < BATCH_SIZE; i++) {
+		mpz_init(batch[i]);
+	}
+
 	printf("Cyclotomic pseudoprimes for l=%d.\n", l);
 	printf("Starting from %d (milestone at every %d, next milestone %d).\n",
 			min, offset, milestone);
@@ -125,45 +155,81 @@ int main(int argc, char **argv)
 	/* if min is even skip to odd */
 	if ( (min % 2) == 0) min++;
 
-	for (i = min; /* infinite loop */ ; i=i+2) {
+	for (i = min; /* infinite loop */ ; ) {
 
-		if (i > milestone) {
-			printf("Reached %d.\n", milestone);
-			milestone += offset;
-		}
+		unsigned int count = 0, j = 0;
+		int k, next = i + 2 * BATCH_SIZE;
 
-		/* N */
-		mpz_set_ui(N, i);
+		/* the composites of the next BATCH_SIZE odd numbers, ramification checked at once */
+		for (k = i; k < next; k += 2) {
 
-		/* if N is not prime */
-		if ( mpz_probab_prime_p(N, 50) == 0 ) {
+			mpz_set_ui(batch[count], k);
 
-			unsigned int is_pseudo;
+			if ( mpz_probab_prime_p(batch[count], 50) == 0 ) {
+				count++;
+			}
+		}
 
-			unsigned int ramify;
+		if ( cpseudo_ramifies_batch(ramify, batch, count, l) ) {
+			printf("Unexpected error.\n");
+			return -1;
+		}
 
-			ramify = cpseudo_ramifies(N, l);
+		for (; i < next; i += 2) {
 
-			/* skip if N ramifies */
-			if (ramify != 0) {
-				 continue;
+			if (i > milestone) {
+				printf("Reached %d.\n", milestone);
+				milestone += offset;
 			}
 
-			is_pseudo=0;
-			ret = cpseudo_fibo(&is_pseudo, N, l, 0);
-			if ( ret ) {
-				printf("Unexpected error.\n");
-				return -1;
-			}
+			/* if N is not prime */
+			if ( j < count && mpz_cmp_ui(batch[j], i) == 0 ) {
 
-			if (is_pseudo) {
-				gmp_printf("%Zd\n", N);
-			}
+				unsigned int is_pseudo;
+
+				/* N */
+				mpz_set(N, batch[j]);
+
+				if ( verify && cpseudo_ramifies_gcd(N, l) != ramify[j] ) {
+					gmp_printf("Ramification mismatch for N=%Zd.\n", N);
+				}
+
+				/* skip if N ramifies */
+				if (ramify[j++] != 0) {
+					 continue;
+				}
+
+				is_pseudo=0;
+				if ( frobenius ) {
+					ret = cpseudo_frobenius(&is_pseudo, N, l, 0);
+				} else {
+
+					/* x = 1 projection first, it rejects most N before any cmatrix */
+					ret = cpseudo_fibo_scalar(&is_pseudo, N, smallest_exp(N, l), 0, 0);
 
+					if ( !ret && is_pseudo ) {
+						ret = cpseudo_fibo(&is_pseudo, N, l, options, 0);
+					}
+				}
+
+				if ( ret ) {
+					printf("Unexpected error.\n");
+					return -1;
+				}
+
+				if (is_pseudo) {
+					gmp_printf("%Zd\n", N);
+				}
+
+			}
 		}
 	}
 
 	/* free mem */
+	for (i = 0; i < BATCH_SIZE; i++) {
+		mpz_clear(batch[i]);
+	}
+
 	mpz_clear(N);
 
 	return 0;
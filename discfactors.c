@@ -0,0 +1,663 @@
+/*
+ * Copyright 2022 Paolo Tassotti
+ *
+ * This file is part of Primality.
+ *
+ * Primality is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU General Public License as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * Primality is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with Primality.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * discfactors.c: prime factors below DISCFACTORBOUND of discriminants[], generated by
+ *                print_disc_factors()
+ */
+
+/* Includes */
+#include "cpseudo.h"
+
+unsigned int disc_factors[DISCFACTORSTOTAL] = {
+	/* 3 */
+	/* 5 */
+	/* 7 */ 29,
+	/* 11 */ 397,
+	/* 13 */ 53, 157,
+	/* 17 */ 137, 953,
+	/* 19 */ 229, 457,
+	/* 23 */ 277, 1013, 1657,
+	/* 29 */
+	/* 31 */ 5581, 8681, 49477,
+	/* 37 */ 149, 593,
+	/* 41 */ 10169, 181549, 12112549,
+	/* 43 */ 173, 101653, 500177,
+	/* 47 */ 3761,
+	/* 53 */ 15358129,
+	/* 59 */ 1181, 3541, 157649, 174877, 5521693,
+	/* 61 */ 733, 1709, 3456749,
+	/* 67 */ 269, 15152453,
+	/* 71 */ 569,
+	/* 73 */ 293, 9929,
+	/* 79 */ 317,
+	/* 83 */ 997, 13063537,
+	/* 89 */ 1069,
+	/* 97 */ 389, 3881, 4657, 5821,
+	/* 101 */ 809,
+	/* 103 */ 41201,
+	/* 107 */ 857, 843589,
+	/* 109 */ 5669,
+	/* 113 */ 58309, 2362153,
+	/* 127 */ 509, 18797, 26417,
+	/* 131 */
+	/* 137 */ 189061,
+	/* 139 */ 557, 1408349,
+	/* 149 */ 1789,
+	/* 151 */
+	/* 157 */
+	/* 163 */ 653, 9781, 7807049,
+	/* 167 */
+	/* 173 */
+	/* 179 */
+	/* 181 */ 9413,
+	/* 191 */ 3821,
+	/* 193 */ 773, 3089, 148997,
+	/* 197 */ 4729, 52009,
+	/* 199 */ 797,
+	/* 211 */
+	/* 223 */ 11597, 6530333,
+	/* 227 */ 5449,
+	/* 229 */ 2749, 5523481,
+	/* 233 */ 30757, 3108221,
+	/* 239 */
+	/* 241 */ 2640397, 15594629,
+	/* 251 */ 5021, 1912621,
+	/* 257 */
+	/* 263 */ 119929, 731141,
+	/* 269 */ 2153, 3229, 5381, 8609, 4273873,
+	/* 271 */ 97561, 10474693,
+	/* 277 */ 1109, 232681,
+	/* 281 */ 3373, 3827221,
+	/* 283 */
+	/* 293 */ 5861, 12893,
+	/* 307 */ 1229, 7369, 93329, 254197, 1021697,
+	/* 311 */ 6221, 21149,
+	/* 313 */ 42569, 681089, 6386453,
+	/* 317 */
+	/* 331 */ 589181,
+	/* 337 */ 5393, 32353, 683437, 2549069,
+	/* 347 */ 2777, 5575597,
+	/* 349 */ 8377, 763613,
+	/* 353 */
+	/* 359 */ 585889, 5199757,
+	/* 367 */
+	/* 373 */ 1493,
+	/* 379 */ 4549, 10219357,
+	/* 383 */ 4597, 13789,
+	/* 389 */ 17117, 51349, 2852149,
+	/* 397 */ 11117, 14293, 25409, 6312301,
+	/* 401 */ 3209,
+	/* 409 */ 1637, 4909, 9817, 1531297, 1856861,
+	/* 419 */ 53633, 63689, 186037, 356989,
+	/* 421 */
+	/* 431 */ 91373, 3754873,
+	/* 433 */ 1733, 5197, 31177, 239017,
+	/* 439 */ 695377,
+	/* 443 */
+	/* 449 */ 3593, 165233, 3615349,
+	/* 457 */ 71293,
+	/* 461 */ 14753, 226813, 7278269,
+	/* 463 */
+	/* 467 */ 252181, 1372981, 13453337,
+	/* 479 */ 6380281,
+	/* 487 */ 1949, 7793, 890237,
+	/* 491 */ 3929,
+	/* 499 */ 1997, 43913, 1179637,
+	/* 503 */ 6037, 10061,
+	/* 509 */ 4073, 103837, 13350053,
+	/* 521 */ 16673,
+	/* 523 */ 8369, 351457,
+	/* 541 */ 1281089, 10393693,
+	/* 547 */
+	/* 557 */
+	/* 563 */ 51797,
+	/* 569 */ 47797, 170701, 257189,
+	/* 571 */ 2384497, 5536417,
+	/* 577 */ 2309,
+	/* 587 */ 35221, 13658317,
+	/* 593 */
+	/* 599 */ 4793, 86257, 306689, 9385133,
+	/* 601 */ 7213, 79333, 685141,
+	/* 607 */
+	/* 613 */
+	/* 617 */ 86381,
+	/* 619 */ 2477, 103993, 284741,
+	/* 631 */ 328121, 651193,
+	/* 641 */
+	/* 643 */
+	/* 647 */ 854041, 9679121,
+	/* 653 */
+	/* 659 */ 5273, 1534153,
+	/* 661 */
+	/* 673 */ 2693, 26921, 419953, 4118761,
+	/* 677 */ 5417,
+	/* 683 */
+	/* 691 */ 11057,
+	/* 701 */
+	/* 709 */ 2837,
+	/* 719 */ 8629,
+	/* 727 */ 2909,
+	/* 733 */ 627449,
+	/* 739 */ 2957, 523213, 6139613,
+	/* 743 */
+	/* 751 */ 9013,
+	/* 757 */
+	/* 761 */ 9133, 82189, 529657, 1567661,
+	/* 769 */
+	/* 773 */ 9277, 961613, 8979169,
+	/* 787 */ 47221, 406093, 14121929,
+	/* 797 */
+	/* 809 */ 6473, 25889, 1948073,
+	/* 811 */ 5336381,
+	/* 821 */
+	/* 823 */ 19753,
+	/* 827 */ 36389, 148861, 2312293,
+	/* 829 */
+	/* 839 */ 5564249,
+	/* 853 */ 3413,
+	/* 857 */
+	/* 859 */ 41233,
+	/* 863 */ 62137,
+	/* 877 */ 136813, 178909,
+	/* 881 */ 292493,
+	/* 883 */ 3533, 10597,
+	/* 887 */
+	/* 907 */
+	/* 911 */ 29153, 109321,
+	/* 919 */ 3677, 169097, 15174529,
+	/* 929 */ 7433, 11149, 85469, 319577, 858397,
+	/* 937 */ 802073,
+	/* 941 */ 3383837,
+	/* 947 */ 189401, 6522937,
+	/* 953 */
+	/* 967 */ 328781, 12056557,
+	/* 971 */ 19421,
+	/* 977 */
+	/* 983 */
+	/* 991 */ 27749, 47569,
+	/* 997 */ 3989, 23929, 1316041,
+	/* 1009 */ 12109, 242161,
+	/* 1013 */
+	/* 1019 */ 61141, 207877,
+	/* 1021 */
+	/* 1031 */ 32993, 181457,
+	/* 1033 */ 4133, 78509,
+	/* 1039 */ 4157,
+	/* 1049 */ 4640777,
+	/* 1051 */ 92489, 1513441, 2030533,
+	/* 1061 */
+	/* 1063 */ 4253, 119057, 2351357,
+	/* 1069 */ 25657,
+	/* 1087 */ 4349, 182617,
+	/* 1091 */ 13093,
+	/* 1093 */ 4373, 13155349,
+	/* 1097 */ 114089,
+	/* 1103 */ 132361, 525029,
+	/* 1109 */ 13309, 115337,
+	/* 1117 */ 40213, 67021,
+	/* 1123 */ 4493, 40429, 597437,
+	/* 1129 */ 4517,
+	/* 1151 */ 36833,
+	/* 1153 */ 152197,
+	/* 1163 */ 37217,
+	/* 1171 */ 13152673,
+	/* 1181 */ 1369961, 9178733,
+	/* 1187 */ 9497, 151937,
+	/* 1193 */
+	/* 1201 */ 2786321, 10938709,
+	/* 1213 */
+	/* 1217 */ 116833, 321289, 408913,
+	/* 1223 */ 44029, 68489,
+	/* 1229 */ 9833, 176977,
+	/* 1231 */ 34469,
+	/* 1237 */ 3265681,
+	/* 1249 */ 529577, 874301,
+	/* 1259 */
+	/* 1277 */ 61297,
+	/* 1279 */
+	/* 1283 */
+	/* 1289 */ 10313, 2206769,
+	/* 1291 */ 15493,
+	/* 1297 */ 5189, 83009,
+	/* 1301 */ 947129,
+	/* 1303 */ 67757, 578533, 4393717,
+	/* 1307 */ 109789, 684869,
+	/* 1319 */ 31657,
+	/* 1321 */
+	/* 1327 */ 5309, 100853, 180473, 541417, 2011733,
+	/* 1361 */ 157877,
+	/* 1367 */ 82021,
+	/* 1373 */
+	/* 1381 */
+	/* 1399 */ 1163969,
+	/* 1409 */ 11273, 129629,
+	/* 1423 */ 5693,
+	/* 1427 */ 713501,
+	/* 1429 */ 5717,
+	/* 1433 */
+	/* 1439 */ 34537, 564089,
+	/* 1447 */
+	/* 1451 */ 133493, 6163849,
+	/* 1453 */ 5813,
+	/* 1459 */
+	/* 1471 */ 23537,
+	/* 1481 */ 3424073,
+	/* 1483 */
+	/* 1487 */ 11897, 10527961,
+	/* 1489 */ 59561,
+	/* 1493 */ 47777, 173189, 214993,
+	/* 1499 */
+	/* 1511 */ 18133,
+	/* 1523 */
+	/* 1531 */ 55117,
+	/* 1543 */ 6173, 18517, 1333153, 4036489,
+	/* 1549 */ 6197,
+	/* 1553 */
+	/* 1559 */
+	/* 1567 */ 6269, 75217,
+	/* 1571 */ 691241,
+	/* 1579 */ 6317,
+	/* 1583 */ 5654477,
+	/* 1597 */ 6389, 38329,
+	/* 1601 */ 12809, 19213, 512321,
+	/* 1607 */ 668513,
+	/* 1609 */ 19309, 2915509, 5702297,
+	/* 1613 */
+	/* 1619 */ 12953, 19429, 3043721, 8392897,
+	/* 1621 */
+	/* 1627 */ 45557, 16230953,
+	/* 1637 */ 15381253,
+	/* 1657 */ 26513,
+	/* 1663 */ 6653, 266081,
+	/* 1667 */
+	/* 1669 */
+	/* 1693 */ 10381477,
+	/* 1697 */ 13577, 1622333, 3740189,
+	/* 1699 */ 20389, 67961,
+	/* 1709 */ 205081,
+	/* 1721 */ 96377,
+	/* 1723 */
+	/* 1733 */ 1060597,
+	/* 1741 */
+	/* 1747 */ 27953, 2264113,
+	/* 1753 */ 7013, 15840109,
+	/* 1759 */
+	/* 1777 */ 7109, 28433, 1179929,
+	/* 1783 */ 171169, 1889981, 5227757,
+	/* 1787 */ 1329529,
+	/* 1789 */ 1867717, 5796361,
+	/* 1801 */
+	/* 1811 */ 14489, 4042153,
+	/* 1823 */ 58337,
+	/* 1831 */ 95213,
+	/* 1847 */ 88657, 125597,
+	/* 1861 */ 290317, 2009881,
+	/* 1867 */ 44809,
+	/* 1871 */ 22453,
+	/* 1873 */ 44953,
+	/* 1877 */
+	/* 1879 */ 7517,
+	/* 1889 */ 45337,
+	/* 1901 */
+	/* 1907 */ 1807837,
+	/* 1913 */
+	/* 1931 */ 23173, 8550469,
+	/* 1933 */ 533509,
+	/* 1949 */ 5769041,
+	/* 1951 */ 54629,
+	/* 1973 */ 23677,
+	/* 1979 */
+	/* 1987 */ 7949,
+	/* 1993 */ 1299437, 2056777,
+	/* 1997 */
+	/* 1999 */
+	/* 2003 */
+	/* 2011 */ 24133,
+	/* 2017 */ 8069, 48409,
+	/* 2027 */ 16217, 12332269,
+	/* 2029 */ 8117, 56813, 348989,
+	/* 2039 */ 24469,
+	/* 2053 */
+	/* 2063 */ 173293,
+	/* 2069 */ 41381,
+	/* 2081 */ 41621, 665921, 4020493, 8989921,
+	/* 2083 */ 1674733, 5082521,
+	/* 2087 */
+	/* 2089 */ 83561, 1228333,
+	/* 2099 */ 92357, 1889101,
+	/* 2111 */ 16889,
+	/* 2113 */
+	/* 2129 */
+	/* 2131 */
+	/* 2137 */ 641101, 1162529, 4051753,
+	/* 2141 */
+	/* 2143 */ 8573, 385741,
+	/* 2153 */ 51673,
+	/* 2161 */
+	/* 2179 */
+	/* 2203 */ 26437,
+	/* 2207 */ 17657, 132421,
+	/* 2213 */ 79669, 398341, 1513693,
+	/* 2221 */ 35537, 133261, 7658009,
+	/* 2237 */ 393713, 644257,
+	/* 2239 */ 626921,
+	/* 2243 */ 71777,
+	/* 2251 */ 837373,
+	/* 2267 */
+	/* 2269 */ 63533,
+	/* 2273 */ 27277, 272761,
+	/* 2281 */ 164233,
+	/* 2287 */
+	/* 2293 */ 9173,
+	/* 2297 */ 275641,
+	/* 2309 */ 2493721, 2789273,
+	/* 2311 */ 64709, 4668221,
+	/* 2333 */ 27997, 363949,
+	/* 2339 */ 28069, 355529, 1001093,
+	/* 2341 */ 1161137, 13989817,
+	/* 2347 */ 628997, 4337257,
+	/* 2351 */ 253909,
+	/* 2357 */
+	/* 2371 */ 493169, 3509081,
+	/* 2377 */ 237701,
+	/* 2381 */
+	/* 2383 */ 9533, 13135097,
+	/* 2389 */ 28669,
+	/* 2393 */
+	/* 2399 */ 28789, 105557, 115153, 3943957,
+	/* 2411 */
+	/* 2417 */ 48341, 87013,
+	/* 2423 */ 174457,
+	/* 2437 */ 9749, 643369,
+	/* 2441 */ 380797,
+	/* 2447 */ 254489, 4610149, 13556381,
+	/* 2459 */ 147541, 295081, 4150793, 6963889,
+	/* 2467 */ 88813,
+	/* 2473 */ 4540429,
+	/* 2477 */
+	/* 2503 */ 4835797,
+	/* 2521 */
+	/* 2531 */ 20249, 4910141,
+	/* 2539 */ 101561, 284369, 1279657,
+	/* 2543 */
+	/* 2549 */ 20393, 509801, 5108197,
+	/* 2551 */ 530609, 16316197,
+	/* 2557 */
+	/* 2579 */ 30949,
+	/* 2591 */
+	/* 2593 */
+	/* 2609 */ 52181, 62617, 208721,
+	/* 2617 */ 73277, 125617, 251233,
+	/* 2621 */
+	/* 2633 */ 4202269,
+	/* 2647 */ 10589, 222349,
+	/* 2657 */
+	/* 2659 */
+	/* 2663 */ 95869,
+	/* 2671 */ 42737, 96157,
+	/* 2677 */ 10709,
+	/* 2683 */ 10733,
+	/* 2687 */ 9468989,
+	/* 2689 */ 548557,
+	/* 2693 */
+	/* 2699 */
+	/* 2707 */ 584713,
+	/* 2711 */ 86753, 379541, 704861,
+	/* 2713 */ 10853, 586009,
+	/* 2719 */
+	/* 2729 */ 54581, 65497,
+	/* 2731 */ 305873,
+	/* 2741 */ 21929, 4736449,
+	/* 2749 */
+	/* 2753 */ 99109,
+	/* 2767 */ 11069,
+	/* 2777 */ 2288249, 8786429,
+	/* 2789 */
+	/* 2791 */ 212117, 435397, 14647169,
+	/* 2797 */
+	/* 2801 */ 22409, 33613,
+	/* 2803 */ 11213,
+	/* 2819 */ 293177,
+	/* 2833 */ 45329, 67993,
+	/* 2837 */
+	/* 2843 */
+	/* 2851 */ 250889, 5987101,
+	/* 2857 */ 1279937,
+	/* 2861 */ 160217,
+	/* 2879 */ 3834829,
+	/* 2887 */ 11549, 3406661,
+	/* 2897 */
+	/* 2903 */ 58061,
+	/* 2909 */ 209449, 244357,
+	/* 2917 */ 70009, 81677,
+	/* 2927 */ 6743809,
+	/* 2939 */ 199853,
+	/* 2953 */ 11813, 35437, 566977, 16170629,
+	/* 2957 */ 59141, 4991417, 8054869,
+	/* 2963 */ 106669,
+	/* 2969 */ 23753, 95009,
+	/* 2971 */
+	/* 2999 */ 12955681, 15510829,
+	/* 3001 */ 48017, 120041, 336113, 720241,
+	/* 3011 */
+	/* 3019 */
+	/* 3023 */ 290209,
+	/* 3037 */ 12149,
+	/* 3041 */
+	/* 3049 */ 12197, 731761,
+	/* 3061 */
+	/* 3067 */ 12269, 73609,
+	/* 3079 */ 12279053,
+	/* 3083 */
+	/* 3089 */
+	/* 3109 */ 12437, 37309, 198977, 6429413,
+	/* 3119 */ 74857, 224569,
+	/* 3121 */ 162293,
+	/* 3137 */ 25097,
+	/* 3163 */ 12653,
+	/* 3167 */ 266029, 633401,
+	/* 3169 */ 126761,
+	/* 3181 */
+	/* 3187 */ 50993,
+	/* 3191 */ 1952893,
+	/* 3203 */ 9557753,
+	/* 3209 */ 77017, 15210661,
+	/* 3217 */
+	/* 3221 */ 1185329, 3246769,
+	/* 3229 */ 12917,
+	/* 3251 */
+	/* 3253 */ 1145057,
+	/* 3257 */
+	/* 3259 */ 13037, 2555057,
+	/* 3271 */
+	/* 3299 */ 26393,
+	/* 3301 */ 1914581,
+	/* 3307 */ 13229, 10476577,
+	/* 3313 */ 6692261, 7672909,
+	/* 3319 */ 39829, 132761, 11390809,
+	/* 3323 */
+	/* 3329 */ 199741,
+	/* 3331 */ 1252457,
+	/* 3343 */ 80233,
+	/* 3347 */ 321313, 6948373,
+	/* 3359 */ 161233, 11245933, 16230689,
+	/* 3361 */
+	/* 3371 */ 2534993,
+	/* 3373 */
+	/* 3389 */
+	/* 3391 */ 1057993,
+	/* 3407 */ 68141, 2071457,
+	/* 3413 */ 122869, 313997, 2662141,
+	/* 3433 */
+	/* 3449 */ 41389,
+	/* 3457 */ 13829,
+	/* 3461 */ 27689, 1772033,
+	/* 3463 */ 180077,
+	/* 3467 */ 27737, 69341,
+	/* 3469 */ 13877,
+	/* 3491 */ 69821,
+	/* 3499 */ 13997, 797773, 5458441,
+	/* 3511 */
+	/* 3517 */ 1997657,
+	/* 3527 */ 10736189,
+	/* 3529 */ 84697, 183509, 296437, 846961,
+	/* 3533 */
+	/* 3539 */ 2491457, 3425753, 5209409,
+	/* 3541 */ 269117, 2889457,
+	/* 3547 */
+	/* 3557 */
+	/* 3559 */ 42709,
+	/* 3571 */
+	/* 3581 */ 28649, 114593,
+	/* 3583 */ 57329, 13988033,
+	/* 3593 */ 71861, 301813, 1063529, 1580921,
+	/* 3607 */ 302989, 865681,
+	/* 3613 */
+	/* 3617 */
+	/* 3623 */ 4289633,
+	/* 3631 */
+	/* 3637 */ 14549, 101837,
+	/* 3643 */ 43717,
+	/* 3659 */ 468353,
+	/* 3671 */
+	/* 3673 */
+	/* 3677 */
+	/* 3691 */ 103349,
+	/* 3697 */ 621097,
+	/* 3701 */
+	/* 3709 */ 5756369,
+	/* 3719 */ 29753,
+	/* 3727 */
+	/* 3733 */
+	/* 3739 */ 14957, 104693, 2034017,
+	/* 3761 */
+	/* 3767 */ 135613,
+	/* 3769 */ 15077, 12181409,
+	/* 3779 */ 90697,
+	/* 3793 */ 15173,
+	/* 3797 */
+	/* 3803 */ 365089,
+	/* 3821 */ 45853, 76421, 1360277,
+	/* 3823 */
+	/* 3833 */
+	/* 3847 */ 61553,
+	/* 3851 */ 30809, 138637,
+	/* 3853 */ 15413, 616481,
+	/* 3863 */
+	/* 3877 */ 2899997,
+	/* 3881 */ 124193, 1893929,
+	/* 3889 */ 108893, 575573,
+	/* 3907 */ 15629, 7829629,
+	/* 3911 */ 2330957, 7868933,
+	/* 3917 */
+	/* 3919 */
+	/* 3923 */ 4315301,
+	/* 3929 */
+	/* 3931 */ 298757,
+	/* 3943 */ 15773, 47317, 851689, 7144717,
+	/* 3947 */
+	/* 3967 */ 13487801,
+	/* 3989 */
+	/* 4001 */ 4113029,
+	/* 4003 */ 624469,
+	/* 4007 */ 32057,
+	/* 4013 */ 48157,
+	/* 4019 */
+	/* 4021 */
+	/* 4027 */ 64433, 11130629,
+	/* 4049 */ 48589,
+	/* 4051 */ 11634473,
+	/* 4057 */ 16229, 4787261, 5517521,
+	/* 4073 */ 244381, 391009,
+	/* 4079 */ 32633, 2284241, 14145973,
+	/* 4091 */
+	/* 4093 */
+};
+
+unsigned int disc_factors_offset[MAXPRIMEINDEX+1] = {
+	0, 0, 0, 1, 2, 4, 6, 8, 11, 11, 14, 16,
+	19, 22, 23, 24, 29, 32, 34, 35, 37, 38, 40, 41,
+	45, 46, 47, 49, 50, 52, 55, 55, 56, 58, 59, 59,
+	59, 62, 62, 62, 62, 63, 64, 67, 69, 70, 70, 72,
+	73, 75, 77, 77, 79, 81, 81, 83, 88, 90, 92, 94,
+	94, 96, 101, 103, 106, 106, 107, 111, 113, 115, 115, 117,
+	117, 118, 120, 122, 125, 129, 130, 135, 139, 139, 141, 145,
+	146, 146, 149, 150, 153, 153, 156, 157, 160, 161, 164, 166,
+	169, 170, 172, 174, 174, 174, 175, 178, 180, 181, 183, 183,
+	187, 190, 190, 190, 191, 194, 196, 196, 196, 198, 198, 200,
+	200, 204, 205, 205, 206, 206, 207, 208, 209, 210, 213, 213,
+	214, 214, 218, 218, 221, 224, 224, 227, 228, 228, 229, 232,
+	232, 233, 234, 234, 235, 236, 238, 239, 241, 241, 241, 243,
+	246, 251, 252, 253, 255, 255, 257, 258, 258, 258, 260, 263,
+	265, 265, 267, 267, 269, 271, 272, 273, 276, 276, 279, 280,
+	282, 283, 285, 286, 288, 290, 292, 295, 296, 297, 298, 299,
+	300, 302, 304, 304, 306, 306, 309, 311, 313, 314, 315, 317,
+	317, 318, 318, 318, 320, 321, 323, 324, 327, 329, 330, 330,
+	335, 336, 337, 337, 337, 338, 340, 341, 342, 343, 343, 345,
+	345, 347, 348, 348, 349, 350, 350, 352, 353, 356, 356, 357,
+	357, 358, 362, 363, 363, 363, 365, 366, 367, 368, 370, 373,
+	374, 377, 377, 381, 381, 383, 384, 385, 387, 387, 387, 388,
+	391, 393, 394, 395, 395, 396, 396, 398, 400, 400, 403, 406,
+	407, 409, 409, 411, 412, 413, 415, 417, 418, 419, 420, 420,
+	421, 422, 422, 423, 423, 425, 426, 427, 428, 429, 429, 430,
+	432, 432, 432, 432, 433, 435, 437, 440, 441, 441, 442, 443,
+	447, 449, 449, 451, 453, 454, 454, 454, 454, 457, 457, 459,
+	460, 460, 460, 461, 463, 466, 469, 471, 472, 473, 474, 474,
+	475, 477, 478, 478, 479, 480, 482, 484, 486, 489, 491, 493,
+	494, 494, 496, 497, 497, 499, 500, 500, 504, 504, 506, 507,
+	509, 510, 513, 517, 518, 519, 519, 520, 520, 522, 525, 525,
+	528, 530, 530, 531, 531, 531, 534, 537, 537, 538, 540, 540,
+	540, 541, 543, 544, 545, 546, 547, 547, 547, 548, 551, 553,
+	553, 555, 556, 558, 558, 559, 560, 562, 562, 565, 565, 567,
+	568, 569, 571, 571, 571, 573, 574, 575, 576, 578, 578, 579,
+	581, 583, 584, 585, 589, 592, 593, 595, 595, 597, 601, 601,
+	601, 602, 603, 603, 605, 605, 607, 608, 608, 608, 612, 614,
+	615, 616, 617, 619, 620, 620, 621, 622, 623, 625, 625, 627,
+	628, 628, 629, 629, 631, 631, 632, 633, 635, 637, 640, 640,
+	641, 642, 643, 645, 648, 648, 649, 649, 649, 650, 652, 655,
+	655, 656, 657, 659, 660, 662, 663, 664, 667, 667, 668, 669,
+	673, 673, 676, 678, 678, 678, 679, 679, 681, 683, 687, 689,
+	689, 689, 690, 690, 692, 693, 694, 694, 694, 694, 695, 696,
+	696, 697, 698, 698, 698, 701, 701, 702, 704, 705, 706, 706,
+	707, 710, 710, 710, 711, 713, 715, 715, 716, 718, 720, 722,
+	724, 724, 724, 725, 725, 726, 730, 730, 731, 731, 732, 733,
+	734, 735, 735, 735, 737, 738, 739, 742, 744, 747, 747, 747
+};
+
+unsigned char disc_cofactors[MAXPRIMEINDEX] = {
+	1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1, 1, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
+};
@@ -23,43 +23,1020 @@
 
 /* Includes */
 #include <stdio.h>
-#include "cpseudo.h"
+#include <stdlib.h>
+#include <time.h>
+#include "cmatrix.h"
+#include "checkpoint.h"
+#include "isprime.h"
+#include "primemap.h"
 
 /*#define VERBOSE
 */
 
-int is_prime(mpz_t N, unsigned int verbose)
+/* Constants */
+#define MAXMODULI	(2 * MAXTABLEINDEX)
+#define MAXRESIDUES	(1UL << 20)		/* residues N^i mod M of ISPRIME_SQRT_BOUND */
+#define MAXWITNESS	100				/* bases a, or Lucas parameters P, tried per factor */
+#define RAMIFY_BATCH	32			/* candidates checked at once by ramifies() */
+#define CALIBRATION_TIME	0.05	/* seconds of cmatrix_mult() it measures */
+
+
+/* Globals */
+
+/* candidate moduli q = p^k for ISPRIME_PRIME_POWERS, sorted by phi(q) */
+static unsigned int moduli[MAXMODULI];
+static unsigned int moduli_prime[MAXMODULI];
+static unsigned int moduli_count = 0;
+
+/* ISPRIME_PLAN candidates: non ramified moduli, their order f and estimated cost */
+static unsigned int plan_l[MAXMODULI];
+static unsigned int plan_p[MAXMODULI];
+static unsigned int plan_f[MAXMODULI];
+static double plan_key[MAXMODULI];
+
+/* bitmap of the small primes, see is_prime_bitmap() */
+static struct primemap bitmap;
+static unsigned int bitmap_mapped = 0;
+
+/* ramification of the candidates first ... first + count - 1, see ramifies() */
+struct ramify_batch {
+	unsigned int first, count;
+	unsigned int flags[RAMIFY_BATCH];
+};
+
+
+/*
+ * compare_moduli(): order the moduli by the ring size phi(q), then by q
+ */
+static int compare_moduli(const void *a, const void *b)
 {
-	int ret = 0;
-	unsigned int is_pseudo=0;
+	unsigned int qa = moduli[*(const unsigned int *) a];
+	unsigned int qb = moduli[*(const unsigned int *) b];
+	unsigned int pa = moduli_prime[*(const unsigned int *) a];
+	unsigned int pb = moduli_prime[*(const unsigned int *) b];
+	unsigned int phia = qa - qa / pa;
+	unsigned int phib = qb - qb / pb;
 
-	/* trivial cases */
-	if (mpz_cmp_ui(N, 0) == 0) { return 0; }
-	if (mpz_cmp_ui(N, 1) == 0) { return 0; }
-	if (mpz_cmp_ui(N, 2) == 0) { return 1; }
-	if (mpz_cmp_ui(N, 5) == 0) { return 1; }
+	if (phia != phib) { return (phia < phib) ? -1 : 1; }
+	if (qa != qb) { return (qa < qb) ? -1 : 1; }
+
+	return 0;
+}
+
+
+/*
+ * init_moduli(): list the primes of the tables and the prime powers of the candidate rings
+ */
+static void init_moduli(void)
+{
+	unsigned int i, k, q;
+	unsigned int order[MAXMODULI];
+	unsigned int tq[MAXMODULI], tp[MAXMODULI];
+
+	if (moduli_count > 0) { return; }
+
+	/* powers of two: zeta_4 = i makes Q a torsion matrix (Q^12 = 1), q = 4 proves nothing */
+	for (q = 8; q <= CYCLO_MAX_SIZE; q *= 2) {
+		tq[moduli_count] = q;
+		tp[moduli_count] = 2;
+		order[moduli_count] = moduli_count;
+		moduli_count++;
+	}
+
+	/* the primes of the tables (which start at 3) and their powers */
+	for (i = 0; i < MAXTABLEINDEX; i++) {
+
+		unsigned int p = table_prime(i);
+
+		for (q = p; q <= MAXTABLEPRIME; q *= p) {
+			tq[moduli_count] = q;
+			tp[moduli_count] = p;
+			order[moduli_count] = moduli_count;
+			moduli_count++;
+		}
+	}
+
+	for (k = 0; k < moduli_count; k++) {
+		moduli[k] = tq[k];
+		moduli_prime[k] = tp[k];
+	}
+
+	qsort(order, moduli_count, sizeof(unsigned int), compare_moduli);
+
+	for (k = 0; k < moduli_count; k++) {
+		moduli[k] = tq[order[k]];
+		moduli_prime[k] = tp[order[k]];
+	}
+}
+
+
+/*
+ * candidate(): the ith modulus q = p^k of the selection, table primes or prime powers
+ */
+static unsigned int candidate(unsigned int i, unsigned int options, unsigned int *p)
+{
+	if (options & ISPRIME_PRIME_POWERS) {
+		*p = moduli_prime[i];
+		return moduli[i];
+	}
+
+	*p = table_prime(i);
+
+	return *p;
+}
+
+
+/*
+ * ramifies(): cpseudo_ramifies() of the ith candidate, the next RAMIFY_BATCH candidates
+ *             (up to last) are checked at once by cpseudo_ramifies_list()
+ *
+ *             with ISPRIME_VERIFY each result is checked against cpseudo_ramifies_gcd()
+ */
+static unsigned int ramifies(struct ramify_batch *batch, mpz_t N, unsigned int i,
+		unsigned int last, unsigned int options)
+{
+	unsigned int k, p;
+	unsigned int ls[RAMIFY_BATCH];
+
+	if (i < batch->first || i >= batch->first + batch->count) {
+
+		batch->first = i;
+		batch->count = 0;
+
+		for (k = i; k < last && batch->count < RAMIFY_BATCH; k++) {
+			ls[batch->count++] = candidate(k, options, &p);
+		}
+
+		/* one candidate only, if the batch cannot be allocated */
+		if ( cpseudo_ramifies_list(batch->flags, N, ls, batch->count) ) {
+			batch->count = 1;
+			batch->flags[0] = cpseudo_ramifies(N, ls[0]);
+		}
+
+		for (k = 0; k < batch->count && (options & ISPRIME_VERIFY); k++) {
+			if (cpseudo_ramifies_gcd(N, ls[k]) != batch->flags[k]) {
+				printf("Ramification mismatch for l = %d, skipping it.\n", ls[k]);
+				batch->flags[k] = 1;
+			}
+		}
+	}
+
+	return batch->flags[i - batch->first];
+}
+
+
+/*
+ * log2_approx(): piecewise linear log2, exact on powers of two
+ */
+static double log2_approx(unsigned int x)
+{
+	unsigned int b = 0;
+
+	while ((x >> b) > 1) { b++; }
+
+	return b + ((double) x / (1U << b) - 1.0);
+}
+
+
+/*
+ * stage_cost(): estimated cost of one N-th power in the ring of q, in products of
+ *               coordinates: size * log2(size) per multiplication
+ */
+static double stage_cost(unsigned int q)
+{
+	unsigned int size = cyclo_ring_size(q, CYCLO_RING_PHI);
+
+	return size * log2_approx(2 * size);
+}
+
+
+/*
+ * compare_plan(): decreasing plan_key
+ */
+static int compare_plan(const void *a, const void *b)
+{
+	double ka = plan_key[*(const unsigned int *) a];
+	double kb = plan_key[*(const unsigned int *) b];
+
+	if (ka != kb) { return (ka > kb) ? -1 : 1; }
+
+	return 0;
+}
+
+
+/*
+ * plan_moduli(): list the non ramified moduli by decreasing bits of bound per cost
+ *
+ * a modulus l costs 2f stages of stage_cost(l) and adds log2(l) bits to the bound,
+ * so taking them by decreasing log2(l) / (2f stage_cost(l)) greedily minimizes the
+ * total cost of a given bound.
+ *
+ * return: the number of candidates, -1 if N is one of the prime moduli
+ */
+static int plan_moduli(mpz_t N, unsigned int options)
+{
+	unsigned int i, k, count = 0, first = 1, last = MAXTABLEINDEX;
+	unsigned int order[MAXMODULI];
+	unsigned int tl[MAXMODULI], tp[MAXMODULI], tf[MAXMODULI];
+	size_t enough = 2 * mpz_sizeinbase(N, 2) + 64;
+	struct ramify_batch batch = { 0 };
+	mpz_t cover;
+
+	if (options & ISPRIME_PRIME_POWERS) {
+		init_moduli();
+		first = 0;
+		last = moduli_count;
+	}
+
+	mpz_init_set_ui(cover, 1);
+
+	/* candidates covering twice the bits of N leave enough choice to the greedy order */
+	for (i = first; i < last && mpz_sizeinbase(cover, 2) < enough; i++) {
+
+		unsigned int p, l = candidate(i, options, &p);
+
+		if (l == p && mpz_cmp_ui(N, l) == 0) {
+			mpz_clear(cover);
+			return -1;
+		}
+
+		if (ramifies(&batch, N, i, last, options) == 1) { continue; }
+
+		mpz_lcm_ui(cover, cover, l);
+
+		tl[count] = l;
+		tp[count] = p;
+		tf[count] = smallest_exp(N, l);
+		plan_key[count] = log2_approx(l) / (2 * tf[count] * stage_cost(l));
+		order[count] = count;
+		count++;
+	}
+
+	/* free mem */
+	mpz_clear(cover);
+
+	qsort(order, count, sizeof(unsigned int), compare_plan);
+
+	for (k = 0; k < count; k++) {
+		plan_l[k] = tl[order[k]];
+		plan_p[k] = tp[order[k]];
+		plan_f[k] = tf[order[k]];
+	}
+
+	return count;
+}
+
+
+/*
+ * order_plan(): run the selected moduli by increasing stage_cost(), the cheapest
+ *               stages reject most composites first
+ */
+static void order_plan(unsigned int *ls, unsigned int *fs, unsigned int count, unsigned int verbose)
+{
+	unsigned int j, k;
+	double total = 0;
+
+	/* insertion sort, count is small */
+	for (j = 1; j < count; j++) {
+
+		unsigned int l = ls[j], f = fs[j];
+
+		for (k = j; k > 0 && stage_cost(ls[k-1]) > stage_cost(l); k--) {
+			ls[k] = ls[k-1];
+			fs[k] = fs[k-1];
+		}
+
+		ls[k] = l;
+		fs[k] = f;
+	}
+
+	if ( !verbose ) { return; }
+
+	for (j = 0; j < count; j++) {
+		printf("Plan: l = %d, f = %d, cost %.0f.\n", ls[j], fs[j], 2 * fs[j] * stage_cost(ls[j]));
+		total += 2 * fs[j] * stage_cost(ls[j]);
+	}
+
+	printf("Plan: %d moduli, cost %.0f coordinate products per bit of N.\n\n", count, total);
+}
+
+
+/*
+ * residues_order(): t = lcm of the orders f, 0 if it exceeds MAXRESIDUES
+ */
+static unsigned long residues_order(unsigned int *fs, unsigned int count)
+{
+	unsigned int j;
+	unsigned long t = 1;
+
+	for (j = 0; j < count; j++) {
+
+		unsigned long a = t, b = fs[j];
+
+		/* gcd */
+		while (b != 0) {
+			unsigned long c = a % b;
+			a = b;
+			b = c;
+		}
+
+		t = (t / a) * fs[j];
+
+		if (t > MAXRESIDUES) { return 0; }
+	}
+
+	return t;
+}
+
+
+/*
+ * crt(): x = a mod m1, x = b mod m2, x < lcm(m1, m2)
+ *
+ * return: 0 if the congruences are compatible, 1 otherwise
+ */
+static unsigned int crt(mpz_t x, mpz_t a, mpz_t m1, mpz_t b, mpz_t m2)
+{
+	unsigned int ret = 0;
+	mpz_t g, d, m, inv;
+
+	mpz_init(g);
+	mpz_init(d);
+	mpz_init(m);
+	mpz_init(inv);
+
+	mpz_gcd(g, m1, m2);
+	mpz_sub(d, b, a);
+
+	if ( !mpz_divisible_p(d, g) ) {
+		ret = 1;
+		goto out;
+	}
+
+	/* x = a + m1 * ((b - a)/g * (m1/g)^-1 mod m2/g) */
+	mpz_divexact(d, d, g);
+	mpz_divexact(m, m2, g);
+	mpz_divexact(inv, m1, g);
+	mpz_invert(inv, inv, m);
+	mpz_mul(d, d, inv);
+	mpz_mod(d, d, m);
+	mpz_mul(x, d, m1);
+	mpz_add(x, x, a);
+
+out:
+	/* free mem */
+	mpz_clear(g);
+	mpz_clear(d);
+	mpz_clear(m);
+	mpz_clear(inv);
+
+	return ret;
+}
+
+
+/*
+ * divisor_elimination(): final step of ISPRIME_SQRT_BOUND
+ *
+ * every divisor r of N is congruent to some N^i mod M, 0 <= i < t, so with M > sqrt(N)
+ * the smallest prime divisor is one of the residues.
+ * Fp is the certified part of N+1 (1 if none): there r = 1 or -1 mod Fp, and the
+ * residue classes are combined by crt().
+ *
+ * return: 1 if a residue is a proper divisor of N, 0 otherwise
+ */
+static unsigned int divisor_elimination(mpz_t N, mpz_t M, mpz_t Fp, unsigned long t, unsigned int verbose)
+{
+	unsigned int ret = 0;
+	unsigned long i;
+	int e;
+	mpz_t r, x, eps;
+
+	mpz_init_set_ui(r, 1);
+	mpz_init(x);
+	mpz_init(eps);
+
+	for (i = 0; i < t && ret == 0; i++) {
+
+		if (i > 0) {
+			mpz_mul(r, r, N);
+			mpz_mod(r, r, M);
+		}
+
+		for (e = 1; e >= -1; e -= 2) {
+
+			if (mpz_cmp_ui(Fp, 1) == 0) {
+				if (e < 0) { break; }
+				mpz_set(x, r);
+			} else {
+				mpz_set_si(eps, e);
+				if (crt(x, r, M, eps, Fp)) { continue; }
+			}
+
+			if (mpz_cmp_ui(x, 1) > 0 && mpz_cmp(x, N) < 0 && mpz_divisible_p(N, x)) {
+
+				if ( verbose ) {
+					gmp_printf("%Zd divides %Zd.\n", x, N);
+				}
+
+				ret = 1;
+				break;
+			}
+		}
+	}
+
+	/* free mem */
+	mpz_clear(r);
+	mpz_clear(x);
+	mpz_clear(eps);
+
+	return ret;
+}
+
+
+/*
+ * lucas_uv(): U_k and, if V is not NULL, V_k mod N of the Lucas sequence of parameters P, Q
+ *
+ * from [[P, -Q], [1, 0]]^k = [[U_k+1, -Q U_k], [U_k, -Q U_k-1]] and V_k = 2 U_k+1 - P U_k
+ */
+static void lucas_uv(mpz_t U, mpz_t V, long P, long Q, mpz_t k, mpz_t N)
+{
+	long i;
+	mpz_t a, b, c, d, t1, t2, t3;
+
+	mpz_init(t1);
+	mpz_init(t2);
+	mpz_init(t3);
+
+	/* [[a, b], [c, d]] = identity */
+	mpz_init_set_ui(a, 1);
+	mpz_init_set_ui(b, 0);
+	mpz_init_set_ui(c, 0);
+	mpz_init_set_ui(d, 1);
+
+	for (i = mpz_sizeinbase(k, 2) - 1; i >= 0; i--) {
+
+		/* square */
+		mpz_mul(t1, a, a);
+		mpz_addmul(t1, b, c);
+		mpz_add(t2, a, d);
+		mpz_mul(t3, b, c);
+		mpz_addmul(t3, d, d);
+		mpz_mul(b, b, t2);
+		mpz_mul(c, c, t2);
+		mpz_mod(a, t1, N);
+		mpz_mod(b, b, N);
+		mpz_mod(c, c, N);
+		mpz_mod(d, t3, N);
+
+		/* multiply by [[P, -Q], [1, 0]] */
+		if (mpz_tstbit(k, i)) {
+			mpz_mul_si(t1, a, P);
+			mpz_add(t1, t1, b);
+			mpz_mul_si(b, a, -Q);
+			mpz_set(a, t1);
+			mpz_mul_si(t1, c, P);
+			mpz_add(t1, t1, d);
+			mpz_mul_si(d, c, -Q);
+			mpz_set(c, t1);
+			mpz_mod(a, a, N);
+			mpz_mod(b, b, N);
+			mpz_mod(c, c, N);
+			mpz_mod(d, d, N);
+		}
+	}
+
+	mpz_set(U, c);
+
+	if (V) {
+		mpz_mul_si(V, c, -P);
+		mpz_addmul_ui(V, a, 2);
+		mpz_mod(V, V, N);
+	}
+
+	/* free mem */
+	mpz_clear(a);
+	mpz_clear(b);
+	mpz_clear(c);
+	mpz_clear(d);
+	mpz_clear(t1);
+	mpz_clear(t2);
+	mpz_clear(t3);
+}
+
+
+/*
+ * selfridge(): first D of 5, -7, 9, -11, ... with (D/N) = -1
+ *
+ * such a D exists unless N is a square, checked once MAXWITNESS candidates failed:
+ * the search is not capped after it, so that no prime is left without D.
+ *
+ * return: D, 0 if N has a factor among the |D| or N is a square
+ */
+static long selfridge(mpz_t N)
+{
+	unsigned int k;
+	long D = 5;
+	mpz_t Dz;
+
+	mpz_init(Dz);
+
+	for (k = 0; ; k++) {
+
+		int jacobi;
+
+		if (k == MAXWITNESS && mpz_perfect_square_p(N)) { D = 0; break; }
+
+		mpz_set_si(Dz, D);
+		jacobi = mpz_jacobi(Dz, N);
+
+		if (jacobi == -1) { break; }
+
+		if (jacobi == 0) {
+			mpz_abs(Dz, Dz);
+			if (mpz_cmp(Dz, N) != 0) { D = 0; break; }
+		}
+
+		D = (D > 0) ? -(D + 2) : -(D - 2);
+	}
+
+	mpz_clear(Dz);
+
+	return D;
+}
+
+
+/*
+ * init_primorial(): product of 2 and of the primes of the table, computed once
+ */
+static mpz_t primorial;
+static unsigned int primorial_init = 0;
+
+static void init_primorial(void)
+{
+	unsigned int i;
+
+	if ( primorial_init ) { return; }
+
+	mpz_init_set_ui(primorial, 2);
+
+	for (i = 0; i < MAXPRIMEINDEX; i++) {
+		mpz_mul_ui(primorial, primorial, primes[i]);
+	}
+
+	primorial_init = 1;
+}
+
+
+/*
+ * strong_fermat(): strong probable prime test to base 2
+ */
+static unsigned int strong_fermat(mpz_t N)
+{
+	unsigned int ret = 0;
+	mp_bitcnt_t s, r;
+	mpz_t d, x, m, base;
+
+	mpz_init(d);
+	mpz_init(x);
+	mpz_init(m);
+	mpz_init_set_ui(base, 2);
+
+	/* N-1 = d*2^s */
+	mpz_sub_ui(m, N, 1);
+	s = mpz_scan1(m, 0);
+	mpz_tdiv_q_2exp(d, m, s);
+
+	mpz_powm(x, base, d, N);
+
+	if (mpz_cmp_ui(x, 1) == 0 || mpz_cmp(x, m) == 0) { ret = 1; }
+
+	for (r = 1; r < s && ret == 0; r++) {
+		mpz_mul(x, x, x);
+		mpz_mod(x, x, N);
+		if (mpz_cmp(x, m) == 0) { ret = 1; }
+	}
+
+	/* free mem */
+	mpz_clear(d);
+	mpz_clear(x);
+	mpz_clear(m);
+	mpz_clear(base);
+
+	return ret;
+}
+
+
+/*
+ * strong_lucas(): strong Lucas probable prime test, Selfridge parameters
+ *
+ * N+1 = d*2^s: U_d = 0 or V_(d*2^r) = 0 for some 0 <= r < s, with V_2k = V_k^2 - 2Q^k
+ */
+static unsigned int strong_lucas(mpz_t N)
+{
+	unsigned int ret = 0;
+	mp_bitcnt_t s, r;
+	long D, Q;
+	mpz_t d, U, V, Qk;
+
+	D = selfridge(N);
+	if (D == 0) { return 0; }
+
+	Q = (1 - D) / 4;
+
+	mpz_init(d);
+	mpz_init(U);
+	mpz_init(V);
+	mpz_init(Qk);
+
+	/* N+1 = d*2^s */
+	mpz_add_ui(d, N, 1);
+	s = mpz_scan1(d, 0);
+	mpz_tdiv_q_2exp(d, d, s);
+
+	lucas_uv(U, V, 1, Q, d, N);
+
+	mpz_set_si(Qk, Q);
+	mpz_mod(Qk, Qk, N);
+	mpz_powm(Qk, Qk, d, N);
+
+	if (mpz_sgn(U) == 0 || mpz_sgn(V) == 0) { ret = 1; }
+
+	for (r = 1; r < s && ret == 0; r++) {
+
+		mpz_mul(V, V, V);
+		mpz_submul_ui(V, Qk, 2);
+		mpz_mod(V, V, N);
+
+		mpz_mul(Qk, Qk, Qk);
+		mpz_mod(Qk, Qk, N);
+
+		if (mpz_sgn(V) == 0) { ret = 1; }
+	}
+
+	/* free mem */
+	mpz_clear(d);
+	mpz_clear(U);
+	mpz_clear(V);
+	mpz_clear(Qk);
+
+	return ret;
+}
+
+
+/*
+ * prefilter(): cheap compositeness checks, each enabled by its option
+ *
+ * ISPRIME_PREFILTER_GCD: gcd of N with the cached primorial of the table primes
+ * ISPRIME_PREFILTER_POWER: N is a perfect power
+ * ISPRIME_PREFILTER_BPSW: strong base 2 and strong Lucas probable prime tests
+ *
+ * return: 0 if N is composite, 1 if N is prime by the gcd check, 2 otherwise
+ */
+static unsigned int prefilter(mpz_t N, unsigned int options, unsigned int verbose)
+{
+	unsigned int ret = 2;
+	mpz_t g;
+
+	mpz_init(g);
+
+	if (options & ISPRIME_PREFILTER_GCD) {
+
+		init_primorial();
+
+		mpz_gcd(g, N, primorial);
+
+		/* N <= MAXPRIME is prime iff it divides the primorial and is in the table */
+		if (mpz_cmp_ui(g, 1) != 0) {
+
+			ret = 0;
+
+			if (mpz_cmp(g, N) == 0 && mpz_cmp_ui(N, MAXPRIME) <= 0 &&
+					prime_to_index[mpz_get_ui(N)] >= 0) {
+				ret = 1;
+			}
+
+			if ( verbose && ret == 0 ) {
+				gmp_printf("%Zd has the small factor %Zd.\n", N, g);
+			}
+
+			goto out;
+		}
+	}
+
+	if (options & ISPRIME_PREFILTER_POWER) {
+
+		if ( mpz_perfect_power_p(N) ) {
+
+			if ( verbose ) {
+				gmp_printf("%Zd is a perfect power.\n", N);
+			}
+
+			ret = 0;
+			goto out;
+		}
+	}
+
+	if (options & ISPRIME_PREFILTER_BPSW) {
+
+		if ( !strong_fermat(N) || !strong_lucas(N) ) {
+
+			if ( verbose ) {
+				gmp_printf("%Zd is not a BPSW probable prime.\n", N);
+			}
+
+			ret = 0;
+			goto out;
+		}
+	}
+
+out:
+	mpz_clear(g);
+
+	return ret;
+}
+
+
+/*
+ * certify_factor(): check that q is a prime factor of N-1 (sign < 0) or N+1 (sign > 0)
+ *
+ * return: 1 if q is a prime factor, 0 otherwise
+ */
+static unsigned int certify_factor(mpz_t q, mpz_t N, int sign, unsigned int options, unsigned int verbose)
+{
+	unsigned int ret = 1;
+	mpz_t m;
+
+	mpz_init(m);
+
+	if (sign < 0) {
+		mpz_sub_ui(m, N, 1);
+	} else {
+		mpz_add_ui(m, N, 1);
+	}
+
+	if (mpz_cmp_ui(q, 2) < 0 || !mpz_divisible_p(m, q) || mpz_cmp(q, N) >= 0 ||
+			is_prime_ext(q, options, 0) != 1) {
+
+		if ( verbose ) {
+			gmp_printf("%Zd is not a prime factor of N%c1. Ignored.\n", q, (sign < 0) ? '-' : '+');
+		}
+
+		ret = 0;
+	}
+
+	mpz_clear(m);
+
+	return ret;
+}
+
+
+/*
+ * pocklington(): certified part F of N-1 from its known prime factors
+ *
+ * for each q, a base a with a^(N-1) = 1 and gcd(a^((N-1)/q) - 1, N) = 1 gives that every
+ * prime divisor of N is 1 mod q^v, q^v || N-1.
+ *
+ * return: 1 if N is composite, 0 otherwise
+ */
+static unsigned int pocklington(mpz_t F, mpz_t N, mpz_t *factors, unsigned int count,
+		unsigned int options, unsigned int verbose)
+{
+	unsigned int ret = 0, j, a;
+	mpz_t m, e, x, g, base, qv;
+
+	mpz_init(m);
+	mpz_init(e);
+	mpz_init(x);
+	mpz_init(g);
+	mpz_init(base);
+	mpz_init(qv);
+
+	mpz_set_ui(F, 1);
+	mpz_sub_ui(m, N, 1);
+
+	for (j = 0; j < count && ret == 0; j++) {
+
+		if ( !certify_factor(factors[j], N, -1, options, verbose) ) { continue; }
+
+		mpz_divexact(e, m, factors[j]);
+
+		for (a = 2; a < MAXWITNESS; a++) {
+
+			mpz_set_ui(base, a);
+
+			/* Fermat */
+			mpz_powm(x, base, m, N);
+			if (mpz_cmp_ui(x, 1) != 0) { ret = 1; break; }
+
+			mpz_powm(x, base, e, N);
+			mpz_sub_ui(x, x, 1);
+			mpz_gcd(g, x, N);
+
+			if (mpz_cmp_ui(g, 1) == 0) {
+
+				/* q^v */
+				mpz_set(qv, m);
+				mpz_set_ui(x, mpz_remove(qv, qv, factors[j]));
+				mpz_pow_ui(qv, factors[j], mpz_get_ui(x));
+				mpz_lcm(F, F, qv);
+
+				break;
+			}
+
+			if (mpz_cmp(g, N) != 0) { ret = 1; break; }
+		}
+	}
+
+	/* free mem */
+	mpz_clear(m);
+	mpz_clear(e);
+	mpz_clear(x);
+	mpz_clear(g);
+	mpz_clear(base);
+	mpz_clear(qv);
+
+	return ret;
+}
+
+
+/*
+ * morrison(): certified part F of N+1 from its known prime factors
+ *
+ * with a discriminant D, (D/N) = -1, for each q a Lucas sequence (P, Q = (P^2 - D)/4)
+ * with U_(N+1) = 0 and gcd(U_((N+1)/q), N) = 1 gives that every prime divisor r of N
+ * is (D/r) mod q^v, q^v || N+1.
+ *
+ * return: 1 if N is composite, 0 otherwise
+ */
+static unsigned int morrison(mpz_t F, mpz_t N, mpz_t *factors, unsigned int count,
+		unsigned int options, unsigned int verbose)
+{
+	unsigned int ret = 0, j;
+	long D, P, Q;
+	mpz_t m, e, x, g, qv;
+
+	mpz_set_ui(F, 1);
+
+	if (count == 0) { return 0; }
+
+	mpz_init(m);
+	mpz_init(e);
+	mpz_init(x);
+	mpz_init(g);
+	mpz_init(qv);
+
+	mpz_add_ui(m, N, 1);
+
+	/* ASSERT: D = 0 for a small factor or a square, the N+1 part is then left out */
+	D = selfridge(N);
+	if (D == 0) { goto out; }
+
+	for (j = 0; j < count && ret == 0; j++) {
+
+		if ( !certify_factor(factors[j], N, 1, options, verbose) ) { continue; }
+
+		mpz_divexact(e, m, factors[j]);
+
+		for (P = 1; P < 2 * MAXWITNESS; P += 2) {
+
+			Q = (P * P - D) / 4;
+
+			mpz_set_si(x, Q);
+			mpz_gcd(g, x, N);
+			if (mpz_cmp_ui(g, 1) != 0) {
+				if (mpz_cmp(g, N) != 0) { ret = 1; break; }
+				continue;
+			}
+
+			lucas_uv(x, NULL, P, Q, m, N);
+			if (mpz_sgn(x) != 0) { ret = 1; break; }
+
+			lucas_uv(x, NULL, P, Q, e, N);
+			mpz_gcd(g, x, N);
+
+			if (mpz_cmp_ui(g, 1) == 0) {
+
+				/* q^v */
+				mpz_set(qv, m);
+				mpz_set_ui(x, mpz_remove(qv, qv, factors[j]));
+				mpz_pow_ui(qv, factors[j], mpz_get_ui(x));
+				mpz_lcm(F, F, qv);
+
+				break;
+			}
+
+			if (mpz_cmp(g, N) != 0) { ret = 1; break; }
+		}
+	}
+
+out:
+	/* free mem */
+	mpz_clear(m);
+	mpz_clear(e);
+	mpz_clear(x);
+	mpz_clear(g);
+	mpz_clear(qv);
+
+	return ret;
+}
+
+
+/*
+ * select_moduli(): the non ramified moduli ls and the orders fs of N mod l of a proof,
+ *                  with the parts Fm of N-1 and Fp of N+1 certified, see is_prime_hybrid()
+ *
+ * t is the order of the residues N^i mod M for divisor_elimination(), 0 if M > N
+ *
+ * return: the number of moduli, 0 if Fm or Fp is a proof alone, -1 if they run out
+ * before M reaches the bound, -2 if N is one of the prime moduli
+ */
+static int select_moduli(unsigned int *ls, unsigned int *fs, unsigned long *t, mpz_t N,
+		mpz_t Fm, mpz_t Fp, unsigned int options, unsigned int verbose)
+{
+	int count = 0;
+	unsigned int i = 1, j, last = MAXTABLEINDEX;
+	unsigned int sqrt_bound = (options & ISPRIME_SQRT_BOUND) ? 1 : 0;
+	struct ramify_batch batch = { 0 };
+	mpz_t bound, next_bound, target;
 
-	unsigned int i = 1;
+	*t = 0;
 
 	/* initialize primorial upper bound*/
-	mpz_t bound;
 	mpz_init(bound);
-	mpz_set_ui(bound, 1);
+	mpz_init(next_bound);
+	mpz_init(target);
+
+	/* Fm > sqrt(N) (Pocklington) or Fp > sqrt(N) + 1 (Morrison) is a proof alone */
+	mpz_sqrt(target, N);
+	mpz_sub_ui(next_bound, Fp, 1);
+
+	if (mpz_cmp(Fm, target) > 0 || mpz_cmp(next_bound, target) > 0) {
+
+		if ( verbose ) {
+			printf("Proven by the certified parts.\n");
+		}
+
+		goto out;
+	}
+
+	if (options & ISPRIME_PRIME_POWERS) {
+		init_moduli();
+		i = 0;
+		last = moduli_count;
+	}
+
+	if (options & ISPRIME_PLAN) {
+
+		int planned = plan_moduli(N, options);
+
+		if (planned < 0) { count = -2; goto out; }
 
-	/* N-1 */
-	mpz_t N_1;
-	mpz_init(N_1);
-	mpz_sub_ui(N_1, N, 1);
+		i = 0;
+		last = planned;
+	}
+
+	/*
+	 * N^i = 1 mod Fm for every i, so the class of a divisor mod Fm merges with its
+	 * class N^i mod l. Its sign mod Fp may not match i: Fp only counts towards
+	 * M > sqrt(N), where divisor_elimination() combines the classes by CRT.
+	 */
+	if ( sqrt_bound ) {
+		mpz_add_ui(target, target, 1);
+		mpz_lcm(bound, Fm, Fp);
+	} else {
+		mpz_set(target, N);
+		mpz_set(bound, Fm);
+	}
+
+select:
+	while (i < last && mpz_cmp(bound, target) < 0) {
 
-	do {
 		unsigned int ramify = 0;
-		unsigned int l=primes[i];
+		unsigned int p, l = candidate(i, options, &p);
+
+		if (options & ISPRIME_PLAN) {
+			l = plan_l[i];
+			p = plan_p[i];
+		}
+
+		/* skip l if it does not enlarge the lcm */
+		mpz_lcm_ui(next_bound, bound, l);
+		if (mpz_cmp(next_bound, bound) == 0) { goto next; }
 
 		/* check if l is equal to l */
-		if (mpz_cmp_ui(N, l) == 0) { return 1; }
+		if (l == p && mpz_cmp_ui(N, l) == 0) { count = -2; goto out; }
+
+		/* ASSERT: the plan only lists non ramified moduli */
+		if (options & ISPRIME_PLAN) {
+			ls[count] = l;
+			fs[count] = plan_f[i];
+			count++;
+
+			mpz_set(bound, next_bound);
+			goto next;
+		}
 
 		/* check if N ramifies in O(zeta_l) */
-		ramify = cpseudo_ramifies(N, l);
+		ramify = ramifies(&batch, N, i, last, options);
 
 		/* N ramifies ? */
 		if (ramify == 1) {
@@ -71,31 +1048,533 @@ int is_prime(mpz_t N, unsigned int verbose)
 			goto next;
 		}
 
-		/* ASSERT: having reached this point, N does not ramify */
+		ls[count] = l;
+		fs[count] = smallest_exp(N, l);
+		count++;
+
+		mpz_set(bound, next_bound);
+
+next:
+		i++;
+	}
+
+	/* too many residues: fall back to M > N */
+	if ( sqrt_bound ) {
+
+		*t = residues_order(fs, count);
+
+		if (*t == 0) {
+
+			if ( verbose ) {
+				printf("Too many residues, extending M beyond N.\n");
+			}
+
+			sqrt_bound = 0;
+			mpz_set(target, N);
+
+			/* without Fp, see above */
+			mpz_set(bound, Fm);
+
+			for (j = 0; j < (unsigned int) count; j++) {
+				mpz_lcm_ui(bound, bound, ls[j]);
+			}
+
+			if (i < last && mpz_cmp(bound, target) < 0) { goto select; }
+		}
+	}
+
+	/* out of moduli before M reached the target: no proof */
+	if (mpz_cmp(bound, target) < 0) {
+
+		if ( verbose ) {
+			printf("Not enough moduli to certify N.\n");
+		}
+
+		count = -1;
+	}
+
+	if (options & ISPRIME_PLAN && count > 0) {
+		order_plan(ls, fs, count, verbose);
+	}
+
+out:
+	/* free mem */
+	mpz_clear(bound);
+	mpz_clear(next_bound);
+	mpz_clear(target);
+
+	return count;
+}
+
+
+/*
+ * is_prime_bitmap(): answer for the N below its limit from the bitmap written by
+ * primebitmap at path, NULL to stop using it
+ *
+ * the bitmap is mapped read-only and shared, see primemap.h
+ *
+ * return: 0 on success, -1 otherwise
+ */
+int is_prime_bitmap(const char *path)
+{
+	if ( bitmap_mapped ) {
+		primemap_close(&bitmap);
+		bitmap_mapped = 0;
+	}
+
+	if (!path) { return 0; }
+
+	if ( primemap_open(&bitmap, path) ) { return -1; }
+
+	bitmap_mapped = 1;
+
+	return 0;
+}
+
+
+int is_prime(mpz_t N, unsigned int verbose)
+{
+	return is_prime_ext(N, ISPRIME_PREFILTER, verbose);
+}
+
+
+/*
+ * is_prime_ext(): is_prime() with options
+ *
+ * ISPRIME_PRIME_POWERS: also use the rings of the prime powers q = p^k, the moduli
+ * are taken by increasing phi(q) until their lcm exceeds N
+ *
+ * ISPRIME_SQRT_BOUND: stop when M exceeds sqrt(N) and check the residues N^i mod M
+ * as divisors of N, see divisor_elimination()
+ *
+ * ISPRIME_PLAN: choose the moduli by the cost model of plan_moduli() instead of in
+ * increasing order
+ *
+ * ISPRIME_PREFILTER_*: reject most composites before any cyclotomic work, see prefilter()
+ *
+ * ISPRIME_GERBICZ: detect and roll back arithmetic errors of the exponentiations
+ */
+int is_prime_ext(mpz_t N, unsigned int options, unsigned int verbose)
+{
+	return is_prime_hybrid(N, NULL, 0, NULL, 0, options, verbose);
+}
+
+
+/*
+ * is_prime_hybrid(): is_prime_ext() with known prime factors of N-1 (minus) and N+1 (plus)
+ *
+ * the parts Fm of N-1 and Fp of N+1 certified by pocklington() and morrison() start
+ * the bound M, the moduli l are taken until lcm(Fm, l, ...) > N, or until
+ * lcm(Fm, Fp, l, ...) > sqrt(N) with ISPRIME_SQRT_BOUND
+ *
+ * return: -1 if the moduli run out before M reaches the bound, N is not certified
+ */
+int is_prime_hybrid(mpz_t N, mpz_t *minus, unsigned int count_minus, mpz_t *plus,
+		unsigned int count_plus, unsigned int options, unsigned int verbose)
+{
+	return is_prime_checkpoint(N, minus, count_minus, plus, count_plus, options, verbose, NULL);
+}
+
+
+/*
+ * is_prime_checkpoint(): is_prime_hybrid() saving the proof to ckpt
+ *
+ * the moduli l which passed before a loaded checkpoint only enlarge M, and the
+ * exponentiation in progress is resumed, see cpseudo_fibo_checkpoint(). Every l
+ * in ckpt passed for N, so the proof is sound whatever moduli are chosen now.
+ *
+ * return: -1 also if ckpt was loaded for another N, other factors or other options
+ */
+int is_prime_checkpoint(mpz_t N, mpz_t *minus, unsigned int count_minus, mpz_t *plus,
+		unsigned int count_plus, unsigned int options, unsigned int verbose,
+		struct checkpoint *ckpt)
+{
+	int ret = 0;
+	unsigned int is_pseudo=0;
+
+	/* trivial cases */
+	if (mpz_cmp_ui(N, 0) == 0) { return 0; }
+	if (mpz_cmp_ui(N, 1) == 0) { return 0; }
+	if (mpz_cmp_ui(N, 2) == 0) { return 1; }
+	if (mpz_cmp_ui(N, 5) == 0) { return 1; }
+
+	/* below the limit of the bitmap, one bit answers */
+	if ( bitmap_mapped ) {
+
+		int known = primemap_lookup(&bitmap, N);
+
+		if (known >= 0) { return known; }
+	}
+
+	if (ckpt && checkpoint_begin(ckpt, N, minus, count_minus, plus, count_plus, options)) {
+		printf("Checkpoint of another proof.\n");
+		return -1;
+	}
+
+	switch (prefilter(N, options, verbose)) {
+		case 0: return 0;
+		case 1: return 1;
+	}
+
+	unsigned int j;
+	unsigned long t = 0;
+
+	/* certified parts of N-1 and N+1 */
+	mpz_t Fm, Fp;
+	mpz_init(Fm);
+	mpz_init(Fp);
+
+	if (pocklington(Fm, N, minus, count_minus, options, verbose) ||
+			morrison(Fp, N, plus, count_plus, options, verbose)) {
+		mpz_clear(Fm);
+		mpz_clear(Fp);
+		return 0;
+	}
+
+	if ( verbose && (count_minus > 0 || count_plus > 0) ) {
+		gmp_printf("Certified N-1 part %Zd, N+1 part %Zd.\n", Fm, Fp);
+	}
+
+	/* non ramified primes l whose product exceeds N, with the order f of N mod l */
+	unsigned int ls[MAXMODULI];
+	unsigned int fs[MAXMODULI];
+	int selected = select_moduli(ls, fs, &t, N, Fm, Fp, options, verbose);
+
+	if (selected < 0) {
+		mpz_clear(Fm);
+		mpz_clear(Fp);
+		return (selected == -2) ? 1 : -1;
+	}
+
+	unsigned int count = selected;
+
+	mpz_t bound;
+	mpz_init(bound);
+
+	/* x = 1 projection: the scalar Fibonacci test only depends on f */
+	for (j = 0; j < count; j++) {
+
+		unsigned int k, seen = 0;
+
+		for (k = 0; k < j; k++) {
+			if (fs[k] == fs[j]) { seen = 1; break; }
+		}
+
+		if ( seen ) { continue; }
+
+		if ( verbose ) {
+			printf("Scalar test, f = %d.\n", fs[j]);
+		}
+
+		ret = cpseudo_fibo_scalar(&is_pseudo, N, fs[j], CPSEUDO_EARLY_ABORT | CPSEUDO_PHI, verbose);
+		if ( ret ) {
+			printf("Unexpected error.\n");
+			mpz_clear(bound); mpz_clear(Fm); mpz_clear(Fp);
+			return -1;
+		}
+
+		if (!is_pseudo) { mpz_clear(bound); mpz_clear(Fm); mpz_clear(Fp); return 0; }
+	}
+
+	/* ASSERT: having reached this point, the x-1 component passed for every l */
+	mpz_set(bound, Fm);
+
+	unsigned int fibo_options = CPSEUDO_EARLY_ABORT | CPSEUDO_PHI;
+
+	if (options & ISPRIME_GERBICZ) {
+		fibo_options |= CPSEUDO_GERBICZ;
+	}
+
+	for (j = 0; j < count; j++) {
+
+		unsigned int l = ls[j];
 
 		if ( verbose ) {
 			gmp_printf("l = %d.\n", l);
 		}
 
-		ret = cpseudo_fibo(&is_pseudo, N, l, verbose);
+		if ( checkpoint_passed(ckpt, l) ) {
+
+			mpz_lcm_ui(bound, bound, l);
+
+			if ( verbose ) {
+				gmp_printf("Passed before the checkpoint.\nM=%Zd.\n\n", bound);
+			}
+
+			continue;
+		}
+
+		ret = cpseudo_fibo_checkpoint(&is_pseudo, N, l, fibo_options, verbose, ckpt);
 		if ( ret ) {
 			printf("Unexpected error.\n");
+			mpz_clear(bound); mpz_clear(Fm); mpz_clear(Fp);
 			return -1;
 		}
 
-		if (!is_pseudo) {  return 0; }
+		if (!is_pseudo) { mpz_clear(bound); mpz_clear(Fm); mpz_clear(Fp); return 0; }
+
+		if ( ckpt ) {
+			checkpoint_pass(ckpt, l);
+		}
 
-		mpz_mul_ui(bound, bound, l);
+		mpz_lcm_ui(bound, bound, l);
 
-	if ( verbose ) {
-		gmp_printf("Passed.\nM=%Zd.\n\n", bound);
+		if ( verbose ) {
+			gmp_printf("Passed.\nM=%Zd.\n\n", bound);
+		}
 	}
 
-next:
-		i++;
+	/* ASSERT: t > 0 only if M > sqrt(N) was enough */
+	if (t > 0) {
+
+		if ( verbose ) {
+			printf("Divisor elimination, %lu residues.\n", t);
+		}
+
+		if (divisor_elimination(N, bound, Fp, t, verbose)) { mpz_clear(bound); mpz_clear(Fm); mpz_clear(Fp); return 0; }
+	}
 
-	} while (i <= MAXPRIMEINDEX && mpz_cmp(bound, N) < 0);
+	mpz_clear(bound);
+	mpz_clear(Fm);
+	mpz_clear(Fp);
 
 	return 1;
 }
 
+
+/*
+ * is_prime_calibrate(): seconds per cmatrix_mult() of coordinates of the size of N in the
+ *                       ring of q on this machine
+ *
+ * a few products are timed once the coordinates have the size of N
+ */
+double is_prime_calibrate(mpz_t N, unsigned int q)
+{
+	unsigned int k, count = 0;
+	struct cmatrix matrix;
+	struct cmatrix_workspace ws;
+	clock_t start;
+	double elapsed = 0;
+
+	if (cmatrix_init(&matrix, q, CYCLO_RING_PHI) ||
+			cmatrix_workspace_init(&ws, q, CYCLO_RING_PHI, N)) {
+		return 0;
+	}
+
+	/* square until the coordinates have the size of N */
+	for (k = 0; k < 32; k++) {
+		cmatrix_mult(&matrix, &matrix, &matrix, N, &ws);
+	}
+
+	start = clock();
+
+	while (count < 3 || elapsed < CALIBRATION_TIME) {
+		cmatrix_mult(&matrix, &matrix, &matrix, N, &ws);
+		count++;
+		elapsed = (double) (clock() - start) / CLOCKS_PER_SEC;
+	}
+
+	/* free mem */
+	cmatrix_free(&matrix);
+	cmatrix_workspace_free(&ws);
+
+	return elapsed / count;
+}
+
+
+/*
+ * calibrate_scalar(): seconds per product of cpseudo_fibo_scalar() modulo N on this machine
+ */
+static double calibrate_scalar(mpz_t N)
+{
+	unsigned int count = 0;
+	clock_t start;
+	double elapsed = 0;
+	mpz_t a, b, t;
+
+	mpz_init(t);
+	mpz_init(a);
+	mpz_init(b);
+	mpz_sub_ui(a, N, 1);
+	mpz_sub_ui(b, N, 2);
+
+	start = clock();
+
+	/* four products and two reductions, as scalar_mult() */
+	while (count < 3 || elapsed < CALIBRATION_TIME) {
+		mpz_mul(t, a, b);
+		mpz_addmul(t, b, b);
+		mpz_mod(a, t, N);
+		mpz_mul(t, a, b);
+		mpz_addmul(t, a, a);
+		mpz_mod(b, t, N);
+		count++;
+		elapsed = (double) (clock() - start) / CLOCKS_PER_SEC;
+	}
+
+	/* free mem */
+	mpz_clear(t);
+	mpz_clear(a);
+	mpz_clear(b);
+
+	return elapsed / count;
+}
+
+
+/*
+ * compare_size(): order the moduli by ring size
+ */
+static int compare_size(const void *a, const void *b)
+{
+	unsigned int sa = cyclo_ring_size(*(const unsigned int *) a, CYCLO_RING_PHI);
+	unsigned int sb = cyclo_ring_size(*(const unsigned int *) b, CYCLO_RING_PHI);
+
+	return (sa > sb) - (sa < sb);
+}
+
+
+/*
+ * is_prime_estimate(): predict the cost of is_prime_hybrid(N, minus, ..., options) for a
+ *                      prime N
+ *
+ * the moduli are those of select_moduli(), every one runs its 2f Nth powers of
+ * (bits(N) - 1 + weight(N)) cmatrix_mult(). Their time is is_prime_calibrate() on the
+ * smallest, median and largest ring, linearly interpolated in between: the growth with
+ * the size depends on the machine and the flint version. ISPRIME_GERBICZ adds the
+ * checksum and the checks of cmatrix_power(), and each distinct f a scalar test timed
+ * by calibrate_scalar().
+ *
+ * the peak memory is that of the largest ring: the coordinates of the 10 cyclo of
+ * cmatrix_mult() and cmatrix_power() and the flint polynomials of cyclo_mult(), twice
+ * the size of N, plus the packed operands of cmatrix_mult_ks() for huge N and the 4
+ * matrices of the Gerbicz check
+ *
+ * return: 0 on success, -1 otherwise, also if the moduli run out as in is_prime_hybrid()
+ * or the known factors show that N is composite
+ */
+int is_prime_estimate(struct isprime_estimate *est, mpz_t N, mpz_t *minus, unsigned int count_minus,
+		mpz_t *plus, unsigned int count_plus, unsigned int options)
+{
+	/* sanity check */
+	if (!est || !N) return -1;
+
+	est->moduli = 0;
+	est->size = 0;
+	est->mults = 0;
+	est->seconds = 0;
+	est->memory = 0;
+
+	/* no ring is needed */
+	if (mpz_cmp_ui(N, 5) <= 0) { return 0; }
+
+	int selected = -1;
+	unsigned int j, k, count;
+	unsigned int ls[MAXMODULI];
+	unsigned int fs[MAXMODULI];
+	unsigned int sorted[MAXMODULI];
+	unsigned int cs[3];
+	unsigned long t;
+	double ct[3];
+	size_t bits = mpz_sizeinbase(N, 2), coord;
+	double powers, products, scalar;
+	mpz_t Fm, Fp;
+
+	/* the certified parts and the moduli of is_prime_hybrid() */
+	mpz_init(Fm);
+	mpz_init(Fp);
+
+	if (pocklington(Fm, N, minus, count_minus, options, 0) == 0 &&
+			morrison(Fp, N, plus, count_plus, options, 0) == 0) {
+		selected = select_moduli(ls, fs, &t, N, Fm, Fp, options, 0);
+	}
+
+	/* free mem */
+	mpz_clear(Fm);
+	mpz_clear(Fp);
+
+	/* N is one of the moduli */
+	if (selected == -2) { return 0; }
+
+	if (selected < 0) { return -1; }
+
+	if (selected == 0) { return 0; }
+
+	count = selected;
+
+	/* calibration points: smallest, median and largest ring */
+	for (j = 0; j < count; j++) {
+		sorted[j] = ls[j];
+	}
+
+	qsort(sorted, count, sizeof(unsigned int), compare_size);
+
+	for (j = 0; j < 3; j++) {
+		unsigned int q = sorted[(j * (count - 1)) / 2];
+		cs[j] = cyclo_ring_size(q, CYCLO_RING_PHI);
+		ct[j] = (j > 0 && cs[j] == cs[j-1]) ? ct[j-1] : is_prime_calibrate(N, q);
+	}
+
+	powers = (double) (bits - 1 + mpz_popcount(N));
+	products = powers;
+
+	/* one product per block of B bits, and about 2.5 B products per check every B blocks */
+	if (options & ISPRIME_GERBICZ) {
+
+		unsigned int B;
+
+		for (B = 1; (B + 1) * (B + 1) <= bits && B < CMATRIX_GERBICZ_BLOCK; B++) ;
+
+		products += (double) bits / B + 2.5 * B * ((double) bits / ((double) B * B) + 1);
+	}
+
+	for (j = 0; j < count; j++) {
+
+		unsigned int size = cyclo_ring_size(ls[j], CYCLO_RING_PHI);
+		double q;
+
+		k = (size <= cs[1]) ? 0 : 1;
+		q = ct[k];
+
+		if (cs[k+1] > cs[k]) {
+			q += (ct[k+1] - ct[k]) * (size - cs[k]) / (cs[k+1] - cs[k]);
+		}
+
+		est->mults += 2 * fs[j] * products * 4;
+		est->seconds += 2 * fs[j] * products * q;
+
+		if (size > est->size) { est->size = size; }
+	}
+
+	/* the scalar tests, once per distinct f */
+	scalar = calibrate_scalar(N);
+
+	for (j = 0; j < count; j++) {
+
+		unsigned int seen = 0;
+
+		for (k = 0; k < j; k++) {
+			if (fs[k] == fs[j]) { seen = 1; break; }
+		}
+
+		if ( !seen ) {
+			est->seconds += 2 * fs[j] * powers * scalar;
+		}
+	}
+
+	/* unreduced products of twice the size of N, and the mpz header */
+	coord = 2 * (bits / 8) + 32;
+
+	est->moduli = count;
+	est->memory = 16 * (size_t) est->size * coord;
+
+	if (bits >= CMATRIX_KS_MIN_BITS) {
+		est->memory += 12 * (size_t) est->size * coord;
+	}
+
+	/* reduced coordinates */
+	if (options & ISPRIME_GERBICZ) {
+		est->memory += 8 * (size_t) est->size * (bits / 8 + 32);
+	}
+
+	return 0;
+}
@@ -29,12 +29,46 @@
 #include "cpseudo.h"
 
 
+/* Constants */
+#define ISPRIME_PRIME_POWERS	0x01	/* also use the prime power cyclotomic rings */
+#define ISPRIME_SQRT_BOUND		0x02	/* M > sqrt(N) and a final divisor check */
+#define ISPRIME_PLAN			0x04	/* choose and order the moduli by a cost model */
+#define ISPRIME_PREFILTER_GCD	0x08	/* gcd with the primorial of the table primes */
+#define ISPRIME_PREFILTER_POWER	0x10	/* perfect power check */
+#define ISPRIME_PREFILTER_BPSW	0x20	/* strong base 2 and strong Lucas tests */
+#define ISPRIME_VERIFY			0x40	/* check the factored discriminants against a gcd */
+#define ISPRIME_GERBICZ			0x80	/* check the exponentiations, see cmatrix_power() */
+#define ISPRIME_PREFILTER		(ISPRIME_PREFILTER_GCD | ISPRIME_PREFILTER_POWER | ISPRIME_PREFILTER_BPSW)
+
+
+/* Structures Declarations */
+
+/*
+ * Predicted cost of the proof of a prime N, see is_prime_estimate()
+ */
+struct isprime_estimate {
+	unsigned int moduli;	/* cyclotomic rings of the proof */
+	unsigned int size;		/* coordinates of the largest one */
+	double mults;			/* cyclo_mult() calls, every stage run */
+	double seconds;			/* wall time on this machine, see is_prime_calibrate() */
+	size_t memory;			/* peak bytes of the exponentiation in the largest ring */
+};
+
+
 /* Globals */
 extern unsigned int primes[MAXPRIMEINDEX];
 
 
 /* Functions Declarations */
 int is_prime(mpz_t, unsigned int);
+int is_prime_ext(mpz_t, unsigned int, unsigned int);
+int is_prime_hybrid(mpz_t, mpz_t *, unsigned int, mpz_t *, unsigned int, unsigned int, unsigned int);
+int is_prime_checkpoint(mpz_t, mpz_t *, unsigned int, mpz_t *, unsigned int, unsigned int, unsigned int,
+		struct checkpoint *);
+int is_prime_estimate(struct isprime_estimate *, mpz_t, mpz_t *, unsigned int, mpz_t *, unsigned int,
+		unsigned int);
+double is_prime_calibrate(mpz_t, unsigned int);
+int is_prime_bitmap(const char *);
 
 
 #endif
@@ -23,11 +23,18 @@
 
 /* Includes */
 #include <unistd.h>
+#include <getopt.h>
+#include <errno.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <gmp.h>
+#include "checkpoint.h"
 #include "isprime.h"
 
+/* Constants */
+#define MAXPOWERBITS	(1UL << 31)		/* beyond, mpz_pow_ui() aborts or the proof never ends */
 
 
 /* Utility Functions */
@@ -38,33 +45,286 @@ static void usage(const char *message)
 
     printf(
         "Usage: isprime <number>: check if <number> is prime.\n\
-<number> is supposed to be in decimal base.\n\
+<number> is supposed to be in decimal base, expressions like k*b^n+c are accepted.\n\
+isprime -b <file>: answer from the bitmap written by primebitmap below its limit.\n\
+isprime -c: choose and order the cyclotomic rings by a cost model.\n\
+isprime -d: verify the factored discriminant tables and every ramification check.\n\
+isprime -e: estimate the time and memory of the proof instead of running it.\n\
+isprime -g: detect and roll back arithmetic errors of the exponentiations.\n\
 isprime -h: print this help.\n\
+isprime -k <file>: save the proof to <file> every 10 minutes, it is removed once done.\n\
+isprime -r, --resume <file>: resume the proof saved in <file>, and keep saving it.\n\
+isprime -t <seconds>: interval between two saves.\n\
+isprime -n: no prefilter (small factors, perfect powers, BPSW) before the proof.\n\
+isprime -q: also use the prime power cyclotomic rings.\n\
+isprime -s: stop at M > sqrt(N) and check the possible divisors.\n\
+isprime -m <q1,q2,...>: known prime factors of <number> - 1.\n\
+isprime -p <q1,q2,...>: known prime factors of <number> + 1.\n\
 isprime -v: verbose output.\n");
 
     exit(1);
 }
 
 
+/*
+ * parse_power(): digits ('^' digits)?, the power at most MAXPOWERBITS bits
+ *
+ * return: 0 on success, -1 otherwise
+ */
+static int parse_power(mpz_t r, const char **s)
+{
+	const char *start = *s;
+	char *digits, *end;
+	unsigned long e;
+	size_t len;
+	int ret;
+
+	while (**s >= '0' && **s <= '9') { (*s)++; }
+
+	len = *s - start;
+	if (len == 0) { return -1; }
+
+	digits = malloc(len + 1);
+	if ( !digits ) { return -1; }
+
+	memcpy(digits, start, len);
+	digits[len] = '\0';
+
+	ret = mpz_set_str(r, digits, 10);
+
+	/* free mem */
+	free(digits);
+
+	if ( ret ) { return -1; }
+
+	if (**s == '^') {
+
+		(*s)++;
+
+		/* strtoul() would also take spaces and a sign */
+		if (**s < '0' || **s > '9') { return -1; }
+
+		errno = 0;
+		e = strtoul(*s, &end, 10);
+		*s = end;
+
+		if (errno == ERANGE || e == ULONG_MAX) { return -1; }
+
+		if (mpz_cmp_ui(r, 1) > 0 && e > MAXPOWERBITS / (mpz_sizeinbase(r, 2) - 1)) { return -1; }
+
+		mpz_pow_ui(r, r, e);
+	}
+
+	return 0;
+}
+
+static int parse_term(mpz_t r, const char **s)
+{
+	int ret = 0;
+	mpz_t t;
+
+	if ( parse_power(r, s) ) { return -1; }
+
+	mpz_init(t);
+
+	while (**s == '*' && ret == 0) {
+		(*s)++;
+		ret = parse_power(t, s);
+		mpz_mul(r, r, t);
+	}
+
+	mpz_clear(t);
+
+	return ret;
+}
+
+
+/*
+ * parse_expression(): parse integers, '^', '*', '+' and '-', like 2^9689-1 or 3*2^100+1
+ *
+ *		expression := term (('+' | '-') term)*
+ *		term := power ('*' power)*
+ *		power := digits ('^' digits)?
+ *
+ * return: 0 on success, -1 otherwise
+ */
+static int parse_expression(mpz_t r, const char *s)
+{
+	int ret = 0;
+	char op;
+	mpz_t t;
+
+	if ( parse_term(r, &s) ) { return -1; }
+
+	mpz_init(t);
+
+	while ((*s == '+' || *s == '-') && ret == 0) {
+
+		op = *s++;
+		ret = parse_term(t, &s);
+
+		if (op == '+') {
+			mpz_add(r, r, t);
+		} else {
+			mpz_sub(r, r, t);
+		}
+	}
+
+	mpz_clear(t);
+
+	if (*s != '\0') { ret = -1; }
+
+	return ret;
+}
+
+
+/*
+ * parse_factors(): comma separated list of decimal factors
+ *
+ * return: the number of factors, the array is allocated in *factors
+ */
+static unsigned int parse_factors(char *list, mpz_t **factors)
+{
+	unsigned int count = 1, i = 0;
+	char *p, *token;
+
+	for (p = list; *p != '\0'; p++) {
+		if (*p == ',') { count++; }
+	}
+
+	*factors = malloc(count * sizeof(mpz_t));
+	if ( !*factors ) {
+		usage("Out of memory.");
+	}
+
+	for (token = strtok(list, ","); token != NULL; token = strtok(NULL, ",")) {
+
+		mpz_init((*factors)[i]);
+
+		if ( parse_expression((*factors)[i], token) ) {
+			usage("Bad factor specification.");
+		}
+
+		i++;
+	}
+
+	return i;
+}
+
+
+/*
+ * parse_interval(): positive decimal seconds
+ *
+ * return: the seconds, exits through usage() otherwise
+ */
+static unsigned int parse_interval(const char *s)
+{
+	unsigned long x;
+	char *end;
+
+	/* strtoul() would also take spaces and a sign */
+	if (*s < '0' || *s > '9') { usage("Bad interval."); }
+
+	errno = 0;
+	x = strtoul(s, &end, 10);
+
+	if (*end != '\0' || errno == ERANGE || x == 0 || x > UINT_MAX) {
+		usage("Bad interval.");
+	}
+
+	return x;
+}
+
+
 /* Main */
 int main(int argc, char **argv)
 {
 	char c;
 	int ret = 0;
 	int verbose = 0;
+	int estimate = 0;
+	unsigned int options = ISPRIME_PREFILTER;
+	unsigned int count_minus = 0, count_plus = 0, i;
+	mpz_t *minus = NULL, *plus = NULL;
 	mpz_t N;
 
+	/* checkpoint */
+	char *path = NULL;
+	int resume = 0;
+	unsigned int interval = CHECKPOINT_INTERVAL;
+	struct checkpoint ckpt, *ckptp = NULL;
+
+	static struct option long_options[] = {
+		{ "resume", required_argument, NULL, 'r' },
+		{ NULL, 0, NULL, 0 }
+	};
+
 	mpz_init(N);
 
 	opterr = 0;
-	while ( (c = getopt(argc, argv, "hv")) != -1) {
+	while ( (c = getopt_long(argc, argv, "cdeghnqsvb:k:m:p:r:t:", long_options, NULL)) != -1) {
 
 	switch (c) {
 
+		case 'b':
+			if ( is_prime_bitmap(optarg) ) {
+				usage("Bad bitmap file.");
+			}
+			break;
+
+		case 'c':
+			options |= ISPRIME_PLAN;
+			break;
+
+		case 'd':
+			options |= ISPRIME_VERIFY;
+			break;
+
+		case 'e':
+			estimate = 1;
+			break;
+
+		case 'g':
+			options |= ISPRIME_GERBICZ;
+			break;
+
 		case 'h':
 			usage("");
 			break;
 
+		case 'n':
+			options &= ~ISPRIME_PREFILTER;
+			break;
+
+		case 'q':
+			options |= ISPRIME_PRIME_POWERS;
+			break;
+
+		case 's':
+			options |= ISPRIME_SQRT_BOUND;
+			break;
+
+		case 'k':
+			path = optarg;
+			break;
+
+		case 'r':
+			path = optarg;
+			resume = 1;
+			break;
+
+		case 't':
+			interval = parse_interval(optarg);
+			break;
+
+		case 'm':
+			count_minus = parse_factors(optarg, &minus);
+			break;
+
+		case 'p':
+			count_plus = parse_factors(optarg, &plus);
+			break;
+
 		case 'v':
 			verbose=1;
 			break;
@@ -78,23 +338,97 @@ int main(int argc, char **argv)
 	argc -= optind;
 	argv += optind;
 
-	if (argc == 0) {
+	if ( path ) {
+
+		if ( checkpoint_init(&ckpt, path, interval) ) {
+			usage("Out of memory.");
+		}
+
+		ckptp = &ckpt;
+
+		/* N, the known factors and the options of the saved proof */
+		if ( resume ) {
+
+			if ( checkpoint_load(&ckpt) ) {
+				usage("Bad checkpoint file.");
+			}
+
+			mpz_set(N, ckpt.N);
+			options = ckpt.options;
+		}
+	}
+
+	if (argc == 0 && !resume) {
 		usage("Missing argument.");
-	} else {
+	} else if ( !resume ) {
 
-        ret = mpz_set_str(N, argv[0], 10);
+        ret = parse_expression(N, argv[0]);
 
         if ( ret ) {
             usage("Bad integer specification.");
         }
     }
 
-	if (is_prime(N, verbose)) {
-		gmp_printf("%Zd is prime.\n", N);
-		fflush(stdout);
+	if ((options & ISPRIME_VERIFY) && table_verify_factors(1) > 0) {
+		printf("Unexpected error.\n");
+		return -1;
+	}
+
+	if ( estimate ) {
+
+		struct isprime_estimate est;
+
+		if ( resume ) {
+			ret = is_prime_estimate(&est, N, ckpt.minus, ckpt.count_minus, ckpt.plus, ckpt.count_plus,
+					options);
+		} else {
+			ret = is_prime_estimate(&est, N, minus, count_minus, plus, count_plus, options);
+		}
+
+		if ( ret ) {
+			printf("Unexpected error.\n");
+			return -1;
+		}
+
+		printf("Estimate: %d moduli, largest ring %d, %.0f multiplications, %.1f s, %lu bytes.\n",
+				est.moduli, est.size, est.mults, est.seconds, (unsigned long) est.memory);
+
 	} else {
-		gmp_printf("%Zd is not prime.\n", N);
+
+		if ( resume ) {
+			ret = is_prime_checkpoint(N, ckpt.minus, ckpt.count_minus, ckpt.plus, ckpt.count_plus,
+					options, verbose, ckptp);
+		} else {
+			ret = is_prime_checkpoint(N, minus, count_minus, plus, count_plus, options, verbose, ckptp);
+		}
+
+		if (ret < 0) {
+			printf("Unexpected error.\n");
+			return -1;
+		}
+
+		if ( ret ) {
+			gmp_printf("%Zd is prime.\n", N);
+			fflush(stdout);
+		} else {
+			gmp_printf("%Zd is not prime.\n", N);
+		}
+
+		/* the proof is over */
+		if ( ckptp ) {
+			checkpoint_remove(ckptp);
+		}
+	}
+
+	/* free mem */
+	if ( ckptp ) {
+		checkpoint_free(ckptp);
 	}
+	for (i = 0; i < count_minus; i++) { mpz_clear(minus[i]); }
+	for (i = 0; i < count_plus; i++) { mpz_clear(plus[i]); }
+	free(minus);
+	free(plus);
+	mpz_clear(N);
 
 	return 0;
 }
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2022 Paolo Tassotti
+ *
+ * This file is part of Primality.
+ *
+ * Primality is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU General Public License as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * Primality is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with Primality.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * primebitmap.c: write the bitmap of the odd primes below a limit, see primemap.h
+ */
+
+
+/* Includes */
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "primemap.h"
+
+
+/* Utility Functions */
+static void usage(const char *message)
+{
+	if (message[0] != '\0')
+		printf("%s\n", message);
+
+	printf(
+		"Usage: primebitmap <file> [limit]: write the bitmap of the odd primes less than [limit] \
+to <file>.\n\
+[limit] is supposed to be in decimal base and defaults to 4294967296 (2^32).\n\
+The bitmap takes limit / 16 bytes, use it with isprime -b <file> or primelist -b <file>.\n\
+primebitmap -h: print this help.\n");
+
+	exit(1);
+}
+
+
+/* Main */
+int main(int argc, char **argv)
+{
+	char c;
+	char *end;
+	unsigned long limit = PRIMEMAP_LIMIT;
+
+	opterr = 0;
+	while ( (c = getopt(argc, argv, "h")) != -1) {
+
+		switch (c) {
+
+			case 'h':
+				usage("");
+				break;
+
+			case '?':
+				usage("Unrecognized option.");
+
+		}
+	}
+
+	argc -= optind;
+	argv += optind;
+
+	if (argc == 0) {
+		usage("Missing argument.");
+	}
+
+	if (argc >= 2) {
+
+		limit = strtoul(argv[1], &end, 10);
+
+		if (*end != '\0' || limit < 3) {
+			usage("Bad integer specification.");
+		}
+	}
+
+	if ( primemap_create(argv[0], limit) ) {
+		printf("Unexpected error.\n");
+		return -1;
+	}
+
+	printf("Primes less than %lu written to %s.\n", limit, argv[0]);
+
+	return 0;
+}
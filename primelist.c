@@ -46,6 +46,7 @@ static void usage(const char *message)
 less than [max].\n\
 [min] and [max] are supposed to be in decimal base.\n\
 [min] defaults to 3 and [max] defaults to 1000000.\n\
+primelist -b <file>: answer from the bitmap written by primebitmap below its limit.\n\
 primelist -h: print this help.\n");
 
 	exit(1);
@@ -64,10 +65,16 @@ int main(int argc, char **argv)
 	mpz_init(max);
 
 	opterr = 0;
-	while ( (c = getopt(argc, argv, "h")) != -1) {
+	while ( (c = getopt(argc, argv, "hb:")) != -1) {
 
 		switch (c) {
 
+			case 'b':
+				if ( is_prime_bitmap(optarg) ) {
+					usage("Bad bitmap file.");
+				}
+				break;
+
 			case 'h':
 				usage("");
 				break;
@@ -113,7 +120,7 @@ int main(int argc, char **argv)
 
 	do {
 
-		if (is_prime(N, 0)) {
+		if (is_prime(N, 0) == 1) {
 			gmp_printf("%Zd\n", N);
 			fflush(stdout);
 		}
@@ -0,0 +1,254 @@
+/*
+ * Copyright 2022 Paolo Tassotti
+ *
+ * This file is part of Primality.
+ *
+ * Primality is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU General Public License as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * Primality is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with Primality.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * primemap.c: precomputed primality of the small integers, see primemap.h
+ */
+
+/* Includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "primemap.h"
+
+
+/* private functions */
+
+/*
+ * header(): fill the PRIMEMAP_HEADER bytes of a bitmap up to limit
+ */
+static void header(unsigned char *buf, unsigned long limit)
+{
+	unsigned int i;
+
+	memset(buf, 0, PRIMEMAP_HEADER);
+	memcpy(buf, PRIMEMAP_MAGIC, sizeof(PRIMEMAP_MAGIC) - 1);
+
+	for (i = 0; i < 4; i++) {
+		buf[11 - i] = (unsigned char) (PRIMEMAP_VERSION >> (8 * i));
+	}
+
+	for (i = 0; i < 8; i++) {
+		buf[23 - i] = (unsigned char) (limit >> (8 * i));
+	}
+}
+
+
+/* public functions */
+
+/*
+ * primemap_create(): write the bitmap of the odd primes below limit to path
+ *
+ * segmented sieve of Eratosthenes on the odd integers, PRIMEMAP_SEGMENT bytes at a
+ * time, by the odd primes up to sqrt(limit). The file is written as path.tmp and
+ * renamed, so that no process maps a partial bitmap.
+ *
+ * return: 0 on success, -1 otherwise
+ */
+int primemap_create(const char *path, unsigned long limit)
+{
+	/* sanity check */
+	if (!path || limit < 3) return -1;
+
+	int ret = 0;
+	unsigned char buf[PRIMEMAP_HEADER];
+	unsigned char *segment = NULL, *small = NULL;
+	unsigned long *base = NULL;
+	unsigned long root, count = 0, i, j, p;
+	unsigned long odds = limit / 2;		/* 1, 3, ..., below limit */
+	unsigned long lo, hi;
+	char *tmp;
+	FILE *file;
+
+	/* root = isqrt(limit - 1) */
+	for (root = 1; (root + 1) <= (limit - 1) / (root + 1); root++) ;
+
+	/* odd primes up to root, by a plain sieve */
+	small = calloc(root + 1, 1);
+	base = malloc((root / 2 + 1) * sizeof(unsigned long));
+	segment = malloc(PRIMEMAP_SEGMENT);
+	tmp = malloc(strlen(path) + sizeof(".tmp"));
+
+	if (!small || !base || !segment || !tmp) {
+		ret = -1;
+		goto out;
+	}
+
+	for (p = 3; p <= root; p += 2) {
+
+		if ( small[p] ) { continue; }
+
+		base[count++] = p;
+
+		for (j = p * p; j <= root; j += 2 * p) {
+			small[j] = 1;
+		}
+	}
+
+	sprintf(tmp, "%s.tmp", path);
+
+	file = fopen(tmp, "wb");
+	if ( !file ) {
+		ret = -1;
+		goto out;
+	}
+
+	header(buf, limit);
+	if (fwrite(buf, 1, PRIMEMAP_HEADER, file) != PRIMEMAP_HEADER) { ret = -1; }
+
+	/* segment: odd integers 2i + 1 for lo <= i < hi */
+	for (lo = 0; lo < odds && ret == 0; lo = hi) {
+
+		hi = lo + 8 * PRIMEMAP_SEGMENT;
+		if (hi > odds) { hi = odds; }
+
+		memset(segment, 0xff, PRIMEMAP_SEGMENT);
+
+		/* 1 is not prime */
+		if (lo == 0) { segment[0] &= ~1; }
+
+		for (j = 0; j < count; j++) {
+
+			p = base[j];
+
+			/* first odd multiple 2i + 1 of p from max(p^2, 2 lo + 1): i = (p - 1) / 2 mod p */
+			i = (p * p) / 2;
+
+			if (i < lo) {
+				i = lo + ((p - 1) / 2 + p - lo % p) % p;
+			}
+
+			for (; i < hi; i += p) {
+				segment[(i - lo) / 8] &= ~(1 << ((i - lo) % 8));
+			}
+		}
+
+		/* the bits of the last byte beyond limit */
+		if (hi == odds && odds % 8 != 0) {
+			segment[(hi - lo - 1) / 8] &= (1 << (odds % 8)) - 1;
+		}
+
+		i = (hi - lo + 7) / 8;
+		if (fwrite(segment, 1, i, file) != i) { ret = -1; }
+	}
+
+	if (fclose(file) != 0) { ret = -1; }
+
+	if (ret == 0 && rename(tmp, path) != 0) { ret = -1; }
+
+	if ( ret ) { remove(tmp); }
+
+out:
+	/* free mem */
+	free(small);
+	free(base);
+	free(segment);
+	free(tmp);
+
+	return ret;
+}
+
+
+/*
+ * primemap_open(): map the bitmap at path read-only
+ *
+ * return: 0 on success, -1 if the file is missing, truncated or of another version
+ */
+int primemap_open(struct primemap *map, const char *path)
+{
+	/* sanity check */
+	if (!map || !path) return -1;
+
+	unsigned char buf[PRIMEMAP_HEADER];
+	unsigned long limit = 0;
+	unsigned int i;
+	struct stat st;
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) { return -1; }
+
+	if (fstat(fd, &st) != 0 || (size_t) st.st_size < PRIMEMAP_HEADER) {
+		close(fd);
+		return -1;
+	}
+
+	map->length = st.st_size;
+	map->map = mmap(NULL, map->length, PROT_READ, MAP_SHARED, fd, 0);
+
+	/* the mapping holds its own reference to the file */
+	close(fd);
+
+	if (map->map == MAP_FAILED) { return -1; }
+
+	/* limit from the header, then the header must match it */
+	for (i = 0; i < 8; i++) {
+		limit = (limit << 8) | ((const unsigned char *) map->map)[16 + i];
+	}
+
+	header(buf, limit);
+
+	if (limit < 3 || memcmp(map->map, buf, PRIMEMAP_HEADER) != 0 ||
+			map->length != PRIMEMAP_HEADER + (limit / 2 + 7) / 8) {
+		munmap(map->map, map->length);
+		return -1;
+	}
+
+	map->limit = limit;
+	map->bits = (const unsigned char *) map->map + PRIMEMAP_HEADER;
+
+	/* lookups are scattered, readahead would only waste the page cache */
+	madvise(map->map, map->length, MADV_RANDOM);
+
+	return 0;
+}
+
+
+int primemap_close(struct primemap *map)
+{
+	/* sanity check */
+	if (!map) return -1;
+
+	return munmap(map->map, map->length);
+}
+
+
+/*
+ * primemap_lookup(): primality of N from the bitmap
+ *
+ * return: 1 if N is prime, 0 if not, -1 if N is not below the limit
+ */
+int primemap_lookup(struct primemap *map, mpz_t N)
+{
+	/* sanity check */
+	if (!map || !N) return -1;
+
+	if (mpz_sgn(N) <= 0) { return 0; }
+	if (!mpz_fits_ulong_p(N) || mpz_get_ui(N) >= map->limit) { return -1; }
+
+	unsigned long n = mpz_get_ui(N);
+
+	if (n == 2) { return 1; }
+	if (n % 2 == 0) { return 0; }
+
+	return (map->bits[n / 16] >> ((n / 2) % 8)) & 1;
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2022 Paolo Tassotti
+ *
+ * This file is part of Primality.
+ *
+ * Primality is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU General Public License as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * Primality is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with Primality.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ *  primemap.h
+ */
+
+#ifndef __PRIMEMAP_H
+#define __PRIMEMAP_H
+
+
+/* Includes */
+#include <stddef.h>
+#include "gmp.h"
+
+
+/* Constants */
+#define PRIMEMAP_MAGIC		"PRIMBMAP"
+#define PRIMEMAP_VERSION	1
+#define PRIMEMAP_HEADER		24			/* magic, version, 4 zero bytes, limit */
+#define PRIMEMAP_LIMIT		(1UL << 32)	/* default limit of primebitmap */
+#define PRIMEMAP_SEGMENT	(1UL << 18)	/* bytes sieved at once by primemap_create() */
+
+
+/* Structures Declarations */
+
+/*
+ * Read-only mapping of a bitmap of the odd primes below limit, written by
+ * primemap_create():
+ *
+ *		bit i of byte j is set iff 2 * (8j + i) + 1 is prime, 2 * (8j + i) + 1 < limit
+ *
+ * after a header of PRIMEMAP_HEADER bytes, integers big endian. The file is mapped
+ * shared, so the processes using it share the page cache instead of a copy each.
+ *
+ */
+struct primemap {
+	unsigned long limit;
+	const unsigned char *bits;	/* first byte of the bitmap */
+	void *map;
+	size_t length;				/* of the mapping */
+};
+
+
+/* Functions Declarations */
+
+int primemap_create(const char *, unsigned long);
+int primemap_open(struct primemap *, const char *);
+int primemap_close(struct primemap *);
+int primemap_lookup(struct primemap *, mpz_t);
+
+#endif
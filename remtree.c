@@ -0,0 +1,196 @@
+/*
+ * Copyright 2022 Paolo Tassotti
+ *
+ * This file is part of Primality.
+ *
+ * Primality is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU General Public License as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * Primality is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with Primality.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ * remtree.c: product and remainder trees, for the gcd of one number with many moduli
+ */
+
+/* Includes */
+#include <stdlib.h>
+#include "remtree.h"
+
+
+/* public functions */
+
+/*
+ * remtree_init(): build the product tree of the count moduli
+ *
+ * return: 0 on success, -1 otherwise
+ */
+int remtree_init(struct remtree *tree, mpz_srcptr *moduli, unsigned int count)
+{
+	unsigned int i, k, w;
+
+	/* sanity check */
+	if (!tree || !moduli || count == 0) return -1;
+
+	tree->count = count;
+
+	/* depth = ceil(log2(count)) */
+	for (tree->depth = 0, w = count; w > 1; w = (w + 1) / 2) {
+		tree->depth++;
+	}
+
+	tree->width = malloc((tree->depth + 1) * sizeof(unsigned int));
+	tree->level = malloc((tree->depth + 1) * sizeof(mpz_t *));
+	tree->scratch = malloc(count * sizeof(mpz_t));
+
+	if (!tree->width || !tree->level || !tree->scratch) {
+		free(tree->width);
+		free(tree->level);
+		free(tree->scratch);
+		return -1;
+	}
+
+	for (k = 0, w = count; k <= tree->depth; k++, w = (w + 1) / 2) {
+
+		tree->width[k] = w;
+		tree->level[k] = malloc(w * sizeof(mpz_t));
+
+		/* ASSERT: malloc of a few pointers per node does not fail after the above */
+
+		for (i = 0; i < w; i++) {
+
+			if (k == 0) {
+				mpz_init_set(tree->level[0][i], moduli[i]);
+			} else if (2 * i + 1 < tree->width[k-1]) {
+				mpz_init(tree->level[k][i]);
+				mpz_mul(tree->level[k][i], tree->level[k-1][2*i], tree->level[k-1][2*i+1]);
+			} else {
+				mpz_init_set(tree->level[k][i], tree->level[k-1][2*i]);
+			}
+		}
+	}
+
+	for (i = 0; i < count; i++) {
+		mpz_init(tree->scratch[i]);
+	}
+
+	return 0;
+}
+
+
+/*
+ * remtree_free(): free the tree
+ */
+int remtree_free(struct remtree *tree)
+{
+	unsigned int i, k;
+
+	/* sanity check */
+	if (!tree) return -1;
+
+	for (k = 0; k <= tree->depth; k++) {
+
+		for (i = 0; i < tree->width[k]; i++) {
+			mpz_clear(tree->level[k][i]);
+		}
+
+		free(tree->level[k]);
+	}
+
+	for (i = 0; i < tree->count; i++) {
+		mpz_clear(tree->scratch[i]);
+	}
+
+	free(tree->width);
+	free(tree->level);
+	free(tree->scratch);
+
+	return 0;
+}
+
+
+/*
+ * remtree_remainders(): r[i] = x mod m_i for every modulus of the tree
+ *
+ * the remainders of each level are computed from those of the level above, in place
+ * in scratch from the root down: node j only needs the remainder of its parent j/2
+ */
+int remtree_remainders(mpz_t *r, struct remtree *tree, mpz_srcptr x)
+{
+	unsigned int i, k;
+
+	/* sanity check */
+	if (!r || !tree || !x) return -1;
+
+	mpz_mod(tree->scratch[0], x, tree->level[tree->depth][0]);
+
+	for (k = tree->depth; k-- > 0; ) {
+
+		/* by decreasing j, parent j/2 is not overwritten before it is read */
+		for (i = tree->width[k]; i-- > 0; ) {
+			mpz_mod(tree->scratch[i], tree->scratch[i/2], tree->level[k][i]);
+		}
+	}
+
+	for (i = 0; i < tree->count; i++) {
+		mpz_swap(r[i], tree->scratch[i]);
+	}
+
+	return 0;
+}
+
+
+/*
+ * remtree_gcds(): shared[i] = 1 if gcd(x, m_i) > 1, 0 otherwise
+ *
+ * gcd(x, m_i) = gcd(x mod m_i, m_i), the remainders come from the remainder tree
+ *
+ * return: 0 on success, -1 otherwise
+ */
+int remtree_gcds(unsigned int *shared, mpz_srcptr x, mpz_srcptr *moduli, unsigned int count)
+{
+	unsigned int i;
+	struct remtree tree;
+	mpz_t *r;
+
+	/* sanity check */
+	if (!shared || !x || !moduli) return -1;
+
+	if (count == 0) return 0;
+
+	if ( remtree_init(&tree, moduli, count) ) return -1;
+
+	r = malloc(count * sizeof(mpz_t));
+	if (!r) {
+		remtree_free(&tree);
+		return -1;
+	}
+
+	for (i = 0; i < count; i++) {
+		mpz_init(r[i]);
+	}
+
+	remtree_remainders(r, &tree, x);
+
+	for (i = 0; i < count; i++) {
+		mpz_gcd(r[i], r[i], moduli[i]);
+		shared[i] = (mpz_cmp_ui(r[i], 1) > 0);
+	}
+
+	/* free mem */
+	for (i = 0; i < count; i++) {
+		mpz_clear(r[i]);
+	}
+
+	free(r);
+	remtree_free(&tree);
+
+	return 0;
+}
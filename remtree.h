@@ -0,0 +1,57 @@
+/*
+ * Copyright 2022 Paolo Tassotti
+ *
+ * This file is part of Primality.
+ *
+ * Primality is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU General Public License as published by the Free Software Foundation, either version
+ * 3 of the License, or (at your option) any later version.
+ *
+ * Primality is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with Primality.
+ * If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/*
+ *  remtree.h
+ */
+
+#ifndef __REMTREE_H
+#define __REMTREE_H
+
+
+/* Includes */
+#include "gmp.h"
+
+
+/* Structures Declarations */
+
+/*
+ * Product tree of count moduli m_i, and the scratch of the matching remainder tree:
+ *
+ *		level[0][i] = m_i,
+ *		level[k+1][j] = level[k][2j] * level[k][2j+1]	(or level[k][2j] if alone),
+ *		level[depth][0] = the product of all m_i
+ *
+ * x mod m_i for every i costs one reduction of x by the root and one of each node by
+ * its parent, quasi-linear instead of count reductions of x.
+ *
+ */
+struct remtree {
+	unsigned int count;		/* leaves */
+	unsigned int depth;		/* levels above the leaves */
+	unsigned int *width;	/* nodes of each level */
+	mpz_t **level;
+	mpz_t *scratch;			/* count remainders of the level being reduced */
+};
+
+int remtree_init(struct remtree *, mpz_srcptr *, unsigned int);
+int remtree_free(struct remtree *);
+int remtree_remainders(mpz_t *, struct remtree *, mpz_srcptr);
+int remtree_gcds(unsigned int *, mpz_srcptr, mpz_srcptr *, unsigned int);
+
+#endif
@@ -23,11 +23,14 @@
 
 /* includes*/
 #include <stdio.h>
+#include <stdlib.h>
 #include "cpseudo.h"
 
 
 /* globals */
 
+extern char *discriminants[MAXPRIMEINDEX];
+
 /* small prime list */
 unsigned int primes[MAXPRIMEINDEX] = {
 
@@ -74,571 +77,622 @@ unsigned int primes[MAXPRIMEINDEX] = {
 };
 
 
-/* divisors of phi(p)=p-1 for small primes */
-struct divisors_list phi_divisors[MAXPRIMEINDEX] = {
-	{ {2, 1}, 2 },
-	{ {4, 2, 1}, 3 },
-	{ {6, 3, 2, 1}, 4 },
-	{ {10, 5, 2, 1}, 4 },
-	{ {12, 6, 4, 3, 2, 1}, 6 },
-	{ {16, 8, 4, 2, 1}, 5 },
-	{ {18, 9, 6, 3, 2, 1}, 6 },
-	{ {22, 11, 2, 1}, 4 },
-	{ {28, 14, 7, 4, 2, 1}, 6 },
-	{ {30, 15, 10, 6, 5, 3, 2, 1}, 8 },
-	{ {36, 18, 12, 9, 6, 4, 3, 2, 1}, 9 },
-	{ {40, 20, 10, 8, 5, 4, 2, 1}, 8 },
-	{ {42, 21, 14, 7, 6, 3, 2, 1}, 8 },
-	{ {46, 23, 2, 1}, 4 },
-	{ {52, 26, 13, 4, 2, 1}, 6 },
-	{ {58, 29, 2, 1}, 4 },
-	{ {60, 30, 20, 15, 12, 10, 6, 5, 4, 3, 2, 1}, 12 },
-	{ {66, 33, 22, 11, 6, 3, 2, 1}, 8 },
-	{ {70, 35, 14, 10, 7, 5, 2, 1}, 8 },
-	{ {72, 36, 24, 18, 12, 9, 8, 6, 4, 3, 2, 1}, 12 },
-	{ {78, 39, 26, 13, 6, 3, 2, 1}, 8 },
-	{ {82, 41, 2, 1}, 4 },
-	{ {88, 44, 22, 11, 8, 4, 2, 1}, 8 },
-	{ {96, 48, 32, 24, 16, 12, 8, 6, 4, 3, 2, 1}, 12 },
-	{ {100, 50, 25, 20, 10, 5, 4, 2, 1}, 9 },
-	{ {102, 51, 34, 17, 6, 3, 2, 1}, 8 },
-	{ {106, 53, 2, 1}, 4 },
-	{ {108, 54, 36, 27, 18, 12, 9, 6, 4, 3, 2, 1}, 12 },
-	{ {112, 56, 28, 16, 14, 8, 7, 4, 2, 1}, 10 },
-	{ {126, 63, 42, 21, 18, 14, 9, 7, 6, 3, 2, 1}, 12 },
-	{ {130, 65, 26, 13, 10, 5, 2, 1}, 8 },
-	{ {136, 68, 34, 17, 8, 4, 2, 1}, 8 },
-	{ {138, 69, 46, 23, 6, 3, 2, 1}, 8 },
-	{ {148, 74, 37, 4, 2, 1}, 6 },
-	{ {150, 75, 50, 30, 25, 15, 10, 6, 5, 3, 2, 1}, 12 },
-	{ {156, 78, 52, 39, 26, 13, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {162, 81, 54, 27, 18, 9, 6, 3, 2, 1}, 10 },
-	{ {166, 83, 2, 1}, 4 },
-	{ {172, 86, 43, 4, 2, 1}, 6 },
-	{ {178, 89, 2, 1}, 4 },
-	{ {180, 90, 60, 45, 36, 30, 20, 18, 15, 12, 10, 9, 6, 5, 4, 3, 2, 1}, 18 },
-	{ {190, 95, 38, 19, 10, 5, 2, 1}, 8 },
-	{ {192, 96, 64, 48, 32, 24, 16, 12, 8, 6, 4, 3, 2, 1}, 14 },
-	{ {196, 98, 49, 28, 14, 7, 4, 2, 1}, 9 },
-	{ {198, 99, 66, 33, 22, 18, 11, 9, 6, 3, 2, 1}, 12 },
-	{ {210, 105, 70, 42, 35, 30, 21, 15, 14, 10, 7, 6, 5, 3, 2, 1}, 16 },
-	{ {222, 111, 74, 37, 6, 3, 2, 1}, 8 },
-	{ {226, 113, 2, 1}, 4 },
-	{ {228, 114, 76, 57, 38, 19, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {232, 116, 58, 29, 8, 4, 2, 1}, 8 },
-	{ {238, 119, 34, 17, 14, 7, 2, 1}, 8 },
-	{ {240, 120, 80, 60, 48, 40, 30, 24, 20, 16, 15, 12, 10, 8, 6, 5, 4, 3, 2, 1}, 20 },
-	{ {250, 125, 50, 25, 10, 5, 2, 1}, 8 },
-	{ {256, 128, 64, 32, 16, 8, 4, 2, 1}, 9 },
-	{ {262, 131, 2, 1}, 4 },
-	{ {268, 134, 67, 4, 2, 1}, 6 },
-	{ {270, 135, 90, 54, 45, 30, 27, 18, 15, 10, 9, 6, 5, 3, 2, 1}, 16 },
-	{ {276, 138, 92, 69, 46, 23, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {280, 140, 70, 56, 40, 35, 28, 20, 14, 10, 8, 7, 5, 4, 2, 1}, 16 },
-	{ {282, 141, 94, 47, 6, 3, 2, 1}, 8 },
-	{ {292, 146, 73, 4, 2, 1}, 6 },
-	{ {306, 153, 102, 51, 34, 18, 17, 9, 6, 3, 2, 1}, 12 },
-	{ {310, 155, 62, 31, 10, 5, 2, 1}, 8 },
-	{ {312, 156, 104, 78, 52, 39, 26, 24, 13, 12, 8, 6, 4, 3, 2, 1}, 16 },
-	{ {316, 158, 79, 4, 2, 1}, 6 },
-	{ {330, 165, 110, 66, 55, 33, 30, 22, 15, 11, 10, 6, 5, 3, 2, 1}, 16 },
-	{ {336, 168, 112, 84, 56, 48, 42, 28, 24, 21, 16, 14, 12, 8, 7, 6, 4, 3, 2, 1}, 20 },
-	{ {346, 173, 2, 1}, 4 },
-	{ {348, 174, 116, 87, 58, 29, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {352, 176, 88, 44, 32, 22, 16, 11, 8, 4, 2, 1}, 12 },
-	{ {358, 179, 2, 1}, 4 },
-	{ {366, 183, 122, 61, 6, 3, 2, 1}, 8 },
-	{ {372, 186, 124, 93, 62, 31, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {378, 189, 126, 63, 54, 42, 27, 21, 18, 14, 9, 7, 6, 3, 2, 1}, 16 },
-	{ {382, 191, 2, 1}, 4 },
-	{ {388, 194, 97, 4, 2, 1}, 6 },
-	{ {396, 198, 132, 99, 66, 44, 36, 33, 22, 18, 12, 11, 9, 6, 4, 3, 2, 1}, 18 },
-	{ {400, 200, 100, 80, 50, 40, 25, 20, 16, 10, 8, 5, 4, 2, 1}, 15 },
-	{ {408, 204, 136, 102, 68, 51, 34, 24, 17, 12, 8, 6, 4, 3, 2, 1}, 16 },
-	{ {418, 209, 38, 22, 19, 11, 2, 1}, 8 },
-	{ {420, 210, 140, 105, 84, 70, 60, 42, 35, 30, 28, 21, 20, 15, 14, 12, 10, 7, 6, 5, 4, 3, 2, 1}, 24 },
-	{ {430, 215, 86, 43, 10, 5, 2, 1}, 8 },
-	{ {432, 216, 144, 108, 72, 54, 48, 36, 27, 24, 18, 16, 12, 9, 8, 6, 4, 3, 2, 1}, 20 },
-	{ {438, 219, 146, 73, 6, 3, 2, 1}, 8 },
-	{ {442, 221, 34, 26, 17, 13, 2, 1}, 8 },
-	{ {448, 224, 112, 64, 56, 32, 28, 16, 14, 8, 7, 4, 2, 1}, 14 },
-	{ {456, 228, 152, 114, 76, 57, 38, 24, 19, 12, 8, 6, 4, 3, 2, 1}, 16 },
-	{ {460, 230, 115, 92, 46, 23, 20, 10, 5, 4, 2, 1}, 12 },
-	{ {462, 231, 154, 77, 66, 42, 33, 22, 21, 14, 11, 7, 6, 3, 2, 1}, 16 },
-	{ {466, 233, 2, 1}, 4 },
-	{ {478, 239, 2, 1}, 4 },
-	{ {486, 243, 162, 81, 54, 27, 18, 9, 6, 3, 2, 1}, 12 },
-	{ {490, 245, 98, 70, 49, 35, 14, 10, 7, 5, 2, 1}, 12 },
-	{ {498, 249, 166, 83, 6, 3, 2, 1}, 8 },
-	{ {502, 251, 2, 1}, 4 },
-	{ {508, 254, 127, 4, 2, 1}, 6 },
-	{ {520, 260, 130, 104, 65, 52, 40, 26, 20, 13, 10, 8, 5, 4, 2, 1}, 16 },
-	{ {522, 261, 174, 87, 58, 29, 18, 9, 6, 3, 2, 1}, 12 },
-	{ {540, 270, 180, 135, 108, 90, 60, 54, 45, 36, 30, 27, 20, 18, 15, 12, 10, 9, 6, 5, 4, 3, 2, 1}, 24 },
-	{ {546, 273, 182, 91, 78, 42, 39, 26, 21, 14, 13, 7, 6, 3, 2, 1}, 16 },
-	{ {556, 278, 139, 4, 2, 1}, 6 },
-	{ {562, 281, 2, 1}, 4 },
-	{ {568, 284, 142, 71, 8, 4, 2, 1}, 8 },
-	{ {570, 285, 190, 114, 95, 57, 38, 30, 19, 15, 10, 6, 5, 3, 2, 1}, 16 },
-	{ {576, 288, 192, 144, 96, 72, 64, 48, 36, 32, 24, 18, 16, 12, 9, 8, 6, 4, 3, 2, 1}, 21 },
-	{ {586, 293, 2, 1}, 4 },
-	{ {592, 296, 148, 74, 37, 16, 8, 4, 2, 1}, 10 },
-	{ {598, 299, 46, 26, 23, 13, 2, 1}, 8 },
-	{ {600, 300, 200, 150, 120, 100, 75, 60, 50, 40, 30, 25, 24, 20, 15, 12, 10, 8, 6, 5, 4, 3, 2, 1}, 24 },
-	{ {606, 303, 202, 101, 6, 3, 2, 1}, 8 },
-	{ {612, 306, 204, 153, 102, 68, 51, 36, 34, 18, 17, 12, 9, 6, 4, 3, 2, 1}, 18 },
-	{ {616, 308, 154, 88, 77, 56, 44, 28, 22, 14, 11, 8, 7, 4, 2, 1}, 16 },
-	{ {618, 309, 206, 103, 6, 3, 2, 1}, 8 },
-	{ {630, 315, 210, 126, 105, 90, 70, 63, 45, 42, 35, 30, 21, 18, 15, 14, 10, 9, 7, 6, 5, 3, 2, 1}, 24 },
-	{ {640, 320, 160, 128, 80, 64, 40, 32, 20, 16, 10, 8, 5, 4, 2, 1}, 16 },
-	{ {642, 321, 214, 107, 6, 3, 2, 1}, 8 },
-	{ {646, 323, 38, 34, 19, 17, 2, 1}, 8 },
-	{ {652, 326, 163, 4, 2, 1}, 6 },
-	{ {658, 329, 94, 47, 14, 7, 2, 1}, 8 },
-	{ {660, 330, 220, 165, 132, 110, 66, 60, 55, 44, 33, 30, 22, 20, 15, 12, 11, 10, 6, 5, 4, 3, 2, 1}, 24 },
-	{ {672, 336, 224, 168, 112, 96, 84, 56, 48, 42, 32, 28, 24, 21, 16, 14, 12, 8, 7, 6, 4, 3, 2, 1}, 24 },
-	{ {676, 338, 169, 52, 26, 13, 4, 2, 1}, 9 },
-	{ {682, 341, 62, 31, 22, 11, 2, 1}, 8 },
-	{ {690, 345, 230, 138, 115, 69, 46, 30, 23, 15, 10, 6, 5, 3, 2, 1}, 16 },
-	{ {700, 350, 175, 140, 100, 70, 50, 35, 28, 25, 20, 14, 10, 7, 5, 4, 2, 1}, 18 },
-	{ {708, 354, 236, 177, 118, 59, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {718, 359, 2, 1}, 4 },
-	{ {726, 363, 242, 121, 66, 33, 22, 11, 6, 3, 2, 1}, 12 },
-	{ {732, 366, 244, 183, 122, 61, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {738, 369, 246, 123, 82, 41, 18, 9, 6, 3, 2, 1}, 12 },
-	{ {742, 371, 106, 53, 14, 7, 2, 1}, 8 },
-	{ {750, 375, 250, 150, 125, 75, 50, 30, 25, 15, 10, 6, 5, 3, 2, 1}, 16 },
-	{ {756, 378, 252, 189, 126, 108, 84, 63, 54, 42, 36, 28, 27, 21, 18, 14, 12, 9, 7, 6, 4, 3, 2, 1}, 24 },
-	{ {760, 380, 190, 152, 95, 76, 40, 38, 20, 19, 10, 8, 5, 4, 2, 1}, 16 },
-	{ {768, 384, 256, 192, 128, 96, 64, 48, 32, 24, 16, 12, 8, 6, 4, 3, 2, 1}, 18 },
-	{ {772, 386, 193, 4, 2, 1}, 6 },
-	{ {786, 393, 262, 131, 6, 3, 2, 1}, 8 },
-	{ {796, 398, 199, 4, 2, 1}, 6 },
-	{ {808, 404, 202, 101, 8, 4, 2, 1}, 8 },
-	{ {810, 405, 270, 162, 135, 90, 81, 54, 45, 30, 27, 18, 15, 10, 9, 6, 5, 3, 2, 1}, 20 },
-	{ {820, 410, 205, 164, 82, 41, 20, 10, 5, 4, 2, 1}, 12 },
-	{ {822, 411, 274, 137, 6, 3, 2, 1}, 8 },
-	{ {826, 413, 118, 59, 14, 7, 2, 1}, 8 },
-	{ {828, 414, 276, 207, 138, 92, 69, 46, 36, 23, 18, 12, 9, 6, 4, 3, 2, 1}, 18 },
-	{ {838, 419, 2, 1}, 4 },
-	{ {852, 426, 284, 213, 142, 71, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {856, 428, 214, 107, 8, 4, 2, 1}, 8 },
-	{ {858, 429, 286, 143, 78, 66, 39, 33, 26, 22, 13, 11, 6, 3, 2, 1}, 16 },
-	{ {862, 431, 2, 1}, 4 },
-	{ {876, 438, 292, 219, 146, 73, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {880, 440, 220, 176, 110, 88, 80, 55, 44, 40, 22, 20, 16, 11, 10, 8, 5, 4, 2, 1}, 20 },
-	{ {882, 441, 294, 147, 126, 98, 63, 49, 42, 21, 18, 14, 9, 7, 6, 3, 2, 1}, 18 },
-	{ {886, 443, 2, 1}, 4 },
-	{ {906, 453, 302, 151, 6, 3, 2, 1}, 8 },
-	{ {910, 455, 182, 130, 91, 70, 65, 35, 26, 14, 13, 10, 7, 5, 2, 1}, 16 },
-	{ {918, 459, 306, 153, 102, 54, 51, 34, 27, 18, 17, 9, 6, 3, 2, 1}, 16 },
-	{ {928, 464, 232, 116, 58, 32, 29, 16, 8, 4, 2, 1}, 12 },
-	{ {936, 468, 312, 234, 156, 117, 104, 78, 72, 52, 39, 36, 26, 24, 18, 13, 12, 9, 8, 6, 4, 3, 2, 1}, 24 },
-	{ {940, 470, 235, 188, 94, 47, 20, 10, 5, 4, 2, 1}, 12 },
-	{ {946, 473, 86, 43, 22, 11, 2, 1}, 8 },
-	{ {952, 476, 238, 136, 119, 68, 56, 34, 28, 17, 14, 8, 7, 4, 2, 1}, 16 },
-	{ {966, 483, 322, 161, 138, 69, 46, 42, 23, 21, 14, 7, 6, 3, 2, 1}, 16 },
-	{ {970, 485, 194, 97, 10, 5, 2, 1}, 8 },
-	{ {976, 488, 244, 122, 61, 16, 8, 4, 2, 1}, 10 },
-	{ {982, 491, 2, 1}, 4 },
-	{ {990, 495, 330, 198, 165, 110, 99, 90, 66, 55, 45, 33, 30, 22, 18, 15, 11, 10, 9, 6, 5, 3, 2, 1}, 24 },
-	{ {996, 498, 332, 249, 166, 83, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {1008, 504, 336, 252, 168, 144, 126, 112, 84, 72, 63, 56, 48, 42, 36, 28, 24, 21, 18, 16, 14, 12, 9, 8, 7, 6, 4, 3, 2, 1}, 30 },
-	{ {1012, 506, 253, 92, 46, 44, 23, 22, 11, 4, 2, 1}, 12 },
-	{ {1018, 509, 2, 1}, 4 },
-	{ {1020, 510, 340, 255, 204, 170, 102, 85, 68, 60, 51, 34, 30, 20, 17, 15, 12, 10, 6, 5, 4, 3, 2, 1}, 24 },
-	{ {1030, 515, 206, 103, 10, 5, 2, 1}, 8 },
-	{ {1032, 516, 344, 258, 172, 129, 86, 43, 24, 12, 8, 6, 4, 3, 2, 1}, 16 },
-	{ {1038, 519, 346, 173, 6, 3, 2, 1}, 8 },
-	{ {1048, 524, 262, 131, 8, 4, 2, 1}, 8 },
-	{ {1050, 525, 350, 210, 175, 150, 105, 75, 70, 50, 42, 35, 30, 25, 21, 15, 14, 10, 7, 6, 5, 3, 2, 1}, 24 },
-	{ {1060, 530, 265, 212, 106, 53, 20, 10, 5, 4, 2, 1}, 12 },
-	{ {1062, 531, 354, 177, 118, 59, 18, 9, 6, 3, 2, 1}, 12 },
-	{ {1068, 534, 356, 267, 178, 89, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {1086, 543, 362, 181, 6, 3, 2, 1}, 8 },
-	{ {1090, 545, 218, 109, 10, 5, 2, 1}, 8 },
-	{ {1092, 546, 364, 273, 182, 156, 91, 84, 78, 52, 42, 39, 28, 26, 21, 14, 13, 12, 7, 6, 4, 3, 2, 1}, 24 },
-	{ {1096, 548, 274, 137, 8, 4, 2, 1}, 8 },
-	{ {1102, 551, 58, 38, 29, 19, 2, 1}, 8 },
-	{ {1108, 554, 277, 4, 2, 1}, 6 },
-	{ {1116, 558, 372, 279, 186, 124, 93, 62, 36, 31, 18, 12, 9, 6, 4, 3, 2, 1}, 18 },
-	{ {1122, 561, 374, 187, 102, 66, 51, 34, 33, 22, 17, 11, 6, 3, 2, 1}, 16 },
-	{ {1128, 564, 376, 282, 188, 141, 94, 47, 24, 12, 8, 6, 4, 3, 2, 1}, 16 },
-	{ {1150, 575, 230, 115, 50, 46, 25, 23, 10, 5, 2, 1}, 12 },
-	{ {1152, 576, 384, 288, 192, 144, 128, 96, 72, 64, 48, 36, 32, 24, 18, 16, 12, 9, 8, 6, 4, 3, 2, 1}, 24 },
-	{ {1162, 581, 166, 83, 14, 7, 2, 1}, 8 },
-	{ {1170, 585, 390, 234, 195, 130, 117, 90, 78, 65, 45, 39, 30, 26, 18, 15, 13, 10, 9, 6, 5, 3, 2, 1}, 24 },
-	{ {1180, 590, 295, 236, 118, 59, 20, 10, 5, 4, 2, 1}, 12 },
-	{ {1186, 593, 2, 1}, 4 },
-	{ {1192, 596, 298, 149, 8, 4, 2, 1}, 8 },
-	{ {1200, 600, 400, 300, 240, 200, 150, 120, 100, 80, 75, 60, 50, 48, 40, 30, 25, 24, 20, 16, 15, 12, 10, 8, 6, 5, 4, 3, 2, 1}, 30 },
-	{ {1212, 606, 404, 303, 202, 101, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {1216, 608, 304, 152, 76, 64, 38, 32, 19, 16, 8, 4, 2, 1}, 14 },
-	{ {1222, 611, 94, 47, 26, 13, 2, 1}, 8 },
-	{ {1228, 614, 307, 4, 2, 1}, 6 },
-	{ {1230, 615, 410, 246, 205, 123, 82, 41, 30, 15, 10, 6, 5, 3, 2, 1}, 16 },
-	{ {1236, 618, 412, 309, 206, 103, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {1248, 624, 416, 312, 208, 156, 104, 96, 78, 52, 48, 39, 32, 26, 24, 16, 13, 12, 8, 6, 4, 3, 2, 1}, 24 },
-	{ {1258, 629, 74, 37, 34, 17, 2, 1}, 8 },
-	{ {1276, 638, 319, 116, 58, 44, 29, 22, 11, 4, 2, 1}, 12 },
-	{ {1278, 639, 426, 213, 142, 71, 18, 9, 6, 3, 2, 1}, 12 },
-	{ {1282, 641, 2, 1}, 4 },
-	{ {1288, 644, 322, 184, 161, 92, 56, 46, 28, 23, 14, 8, 7, 4, 2, 1}, 16 },
-	{ {1290, 645, 430, 258, 215, 129, 86, 43, 30, 15, 10, 6, 5, 3, 2, 1}, 16 },
-	{ {1296, 648, 432, 324, 216, 162, 144, 108, 81, 72, 54, 48, 36, 27, 24, 18, 16, 12, 9, 8, 6, 4, 3, 2, 1}, 25 },
-	{ {1300, 650, 325, 260, 130, 100, 65, 52, 50, 26, 25, 20, 13, 10, 5, 4, 2, 1}, 18 },
-	{ {1302, 651, 434, 217, 186, 93, 62, 42, 31, 21, 14, 7, 6, 3, 2, 1}, 16 },
-	{ {1306, 653, 2, 1}, 4 },
-	{ {1318, 659, 2, 1}, 4 },
-	{ {1320, 660, 440, 330, 264, 220, 165, 132, 120, 110, 88, 66, 60, 55, 44, 40, 33, 30, 24, 22, 20, 15, 12, 11, 10, 8, 6, 5, 4, 3, 2, 1}, 32 },
-	{ {1326, 663, 442, 221, 102, 78, 51, 39, 34, 26, 17, 13, 6, 3, 2, 1}, 16 },
-	{ {1360, 680, 340, 272, 170, 136, 85, 80, 68, 40, 34, 20, 17, 16, 10, 8, 5, 4, 2, 1}, 20 },
-	{ {1366, 683, 2, 1}, 4 },
-	{ {1372, 686, 343, 196, 98, 49, 28, 14, 7, 4, 2, 1}, 12 },
-	{ {1380, 690, 460, 345, 276, 230, 138, 115, 92, 69, 60, 46, 30, 23, 20, 15, 12, 10, 6, 5, 4, 3, 2, 1}, 24 },
-	{ {1398, 699, 466, 233, 6, 3, 2, 1}, 8 },
-	{ {1408, 704, 352, 176, 128, 88, 64, 44, 32, 22, 16, 11, 8, 4, 2, 1}, 16 },
-	{ {1422, 711, 474, 237, 158, 79, 18, 9, 6, 3, 2, 1}, 12 },
-	{ {1426, 713, 62, 46, 31, 23, 2, 1}, 8 },
-	{ {1428, 714, 476, 357, 238, 204, 119, 102, 84, 68, 51, 42, 34, 28, 21, 17, 14, 12, 7, 6, 4, 3, 2, 1}, 24 },
-	{ {1432, 716, 358, 179, 8, 4, 2, 1}, 8 },
-	{ {1438, 719, 2, 1}, 4 },
-	{ {1446, 723, 482, 241, 6, 3, 2, 1}, 8 },
-	{ {1450, 725, 290, 145, 58, 50, 29, 25, 10, 5, 2, 1}, 12 },
-	{ {1452, 726, 484, 363, 242, 132, 121, 66, 44, 33, 22, 12, 11, 6, 4, 3, 2, 1}, 18 },
-	{ {1458, 729, 486, 243, 162, 81, 54, 27, 18, 9, 6, 3, 2, 1}, 14 },
-	{ {1470, 735, 490, 294, 245, 210, 147, 105, 98, 70, 49, 42, 35, 30, 21, 15, 14, 10, 7, 6, 5, 3, 2, 1}, 24 },
-	{ {1480, 740, 370, 296, 185, 148, 74, 40, 37, 20, 10, 8, 5, 4, 2, 1}, 16 },
-	{ {1482, 741, 494, 247, 114, 78, 57, 39, 38, 26, 19, 13, 6, 3, 2, 1}, 16 },
-	{ {1486, 743, 2, 1}, 4 },
-	{ {1488, 744, 496, 372, 248, 186, 124, 93, 62, 48, 31, 24, 16, 12, 8, 6, 4, 3, 2, 1}, 20 },
-	{ {1492, 746, 373, 4, 2, 1}, 6 },
-	{ {1498, 749, 214, 107, 14, 7, 2, 1}, 8 },
-	{ {1510, 755, 302, 151, 10, 5, 2, 1}, 8 },
-	{ {1522, 761, 2, 1}, 4 },
-	{ {1530, 765, 510, 306, 255, 170, 153, 102, 90, 85, 51, 45, 34, 30, 18, 17, 15, 10, 9, 6, 5, 3, 2, 1}, 24 },
-	{ {1542, 771, 514, 257, 6, 3, 2, 1}, 8 },
-	{ {1548, 774, 516, 387, 258, 172, 129, 86, 43, 36, 18, 12, 9, 6, 4, 3, 2, 1}, 18 },
-	{ {1552, 776, 388, 194, 97, 16, 8, 4, 2, 1}, 10 },
-	{ {1558, 779, 82, 41, 38, 19, 2, 1}, 8 },
-	{ {1566, 783, 522, 261, 174, 87, 58, 54, 29, 27, 18, 9, 6, 3, 2, 1}, 16 },
-	{ {1570, 785, 314, 157, 10, 5, 2, 1}, 8 },
-	{ {1578, 789, 526, 263, 6, 3, 2, 1}, 8 },
-	{ {1582, 791, 226, 113, 14, 7, 2, 1}, 8 },
-	{ {1596, 798, 532, 399, 266, 228, 133, 114, 84, 76, 57, 42, 38, 28, 21, 19, 14, 12, 7, 6, 4, 3, 2, 1}, 24 },
-	{ {1600, 800, 400, 320, 200, 160, 100, 80, 64, 50, 40, 32, 25, 20, 16, 10, 8, 5, 4, 2, 1}, 21 },
-	{ {1606, 803, 146, 73, 22, 11, 2, 1}, 8 },
-	{ {1608, 804, 536, 402, 268, 201, 134, 67, 24, 12, 8, 6, 4, 3, 2, 1}, 16 },
-	{ {1612, 806, 403, 124, 62, 52, 31, 26, 13, 4, 2, 1}, 12 },
-	{ {1618, 809, 2, 1}, 4 },
-	{ {1620, 810, 540, 405, 324, 270, 180, 162, 135, 108, 90, 81, 60, 54, 45, 36, 30, 27, 20, 18, 15, 12, 10, 9, 6, 5, 4, 3, 2, 1}, 30 },
-	{ {1626, 813, 542, 271, 6, 3, 2, 1}, 8 },
-	{ {1636, 818, 409, 4, 2, 1}, 6 },
-	{ {1656, 828, 552, 414, 276, 207, 184, 138, 92, 72, 69, 46, 36, 24, 23, 18, 12, 9, 8, 6, 4, 3, 2, 1}, 24 },
-	{ {1662, 831, 554, 277, 6, 3, 2, 1}, 8 },
-	{ {1666, 833, 238, 119, 98, 49, 34, 17, 14, 7, 2, 1}, 12 },
-	{ {1668, 834, 556, 417, 278, 139, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {1692, 846, 564, 423, 282, 188, 141, 94, 47, 36, 18, 12, 9, 6, 4, 3, 2, 1}, 18 },
-	{ {1696, 848, 424, 212, 106, 53, 32, 16, 8, 4, 2, 1}, 12 },
-	{ {1698, 849, 566, 283, 6, 3, 2, 1}, 8 },
-	{ {1708, 854, 427, 244, 122, 61, 28, 14, 7, 4, 2, 1}, 12 },
-	{ {1720, 860, 430, 344, 215, 172, 86, 43, 40, 20, 10, 8, 5, 4, 2, 1}, 16 },
-	{ {1722, 861, 574, 287, 246, 123, 82, 42, 41, 21, 14, 7, 6, 3, 2, 1}, 16 },
-	{ {1732, 866, 433, 4, 2, 1}, 6 },
-	{ {1740, 870, 580, 435, 348, 290, 174, 145, 116, 87, 60, 58, 30, 29, 20, 15, 12, 10, 6, 5, 4, 3, 2, 1}, 24 },
-	{ {1746, 873, 582, 291, 194, 97, 18, 9, 6, 3, 2, 1}, 12 },
-	{ {1752, 876, 584, 438, 292, 219, 146, 73, 24, 12, 8, 6, 4, 3, 2, 1}, 16 },
-	{ {1758, 879, 586, 293, 6, 3, 2, 1}, 8 },
-	{ {1776, 888, 592, 444, 296, 222, 148, 111, 74, 48, 37, 24, 16, 12, 8, 6, 4, 3, 2, 1}, 20 },
-	{ {1782, 891, 594, 297, 198, 162, 99, 81, 66, 54, 33, 27, 22, 18, 11, 9, 6, 3, 2, 1}, 20 },
-	{ {1786, 893, 94, 47, 38, 19, 2, 1}, 8 },
-	{ {1788, 894, 596, 447, 298, 149, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {1800, 900, 600, 450, 360, 300, 225, 200, 180, 150, 120, 100, 90, 75, 72, 60, 50, 45, 40, 36, 30, 25, 24, 20, 18, 15, 12, 10, 9, 8, 6, 5, 4, 3, 2, 1}, 36 },
-	{ {1810, 905, 362, 181, 10, 5, 2, 1}, 8 },
-	{ {1822, 911, 2, 1}, 4 },
-	{ {1830, 915, 610, 366, 305, 183, 122, 61, 30, 15, 10, 6, 5, 3, 2, 1}, 16 },
-	{ {1846, 923, 142, 71, 26, 13, 2, 1}, 8 },
-	{ {1860, 930, 620, 465, 372, 310, 186, 155, 124, 93, 62, 60, 31, 30, 20, 15, 12, 10, 6, 5, 4, 3, 2, 1}, 24 },
-	{ {1866, 933, 622, 311, 6, 3, 2, 1}, 8 },
-	{ {1870, 935, 374, 187, 170, 110, 85, 55, 34, 22, 17, 11, 10, 5, 2, 1}, 16 },
-	{ {1872, 936, 624, 468, 312, 234, 208, 156, 144, 117, 104, 78, 72, 52, 48, 39, 36, 26, 24, 18, 16, 13, 12, 9, 8, 6, 4, 3, 2, 1}, 30 },
-	{ {1876, 938, 469, 268, 134, 67, 28, 14, 7, 4, 2, 1}, 12 },
-	{ {1878, 939, 626, 313, 6, 3, 2, 1}, 8 },
-	{ {1888, 944, 472, 236, 118, 59, 32, 16, 8, 4, 2, 1}, 12 },
-	{ {1900, 950, 475, 380, 190, 100, 95, 76, 50, 38, 25, 20, 19, 10, 5, 4, 2, 1}, 18 },
-	{ {1906, 953, 2, 1}, 4 },
-	{ {1912, 956, 478, 239, 8, 4, 2, 1}, 8 },
-	{ {1930, 965, 386, 193, 10, 5, 2, 1}, 8 },
-	{ {1932, 966, 644, 483, 322, 276, 161, 138, 92, 84, 69, 46, 42, 28, 23, 21, 14, 12, 7, 6, 4, 3, 2, 1}, 24 },
-	{ {1948, 974, 487, 4, 2, 1}, 6 },
-	{ {1950, 975, 650, 390, 325, 195, 150, 130, 78, 75, 65, 50, 39, 30, 26, 25, 15, 13, 10, 6, 5, 3, 2, 1}, 24 },
-	{ {1972, 986, 493, 116, 68, 58, 34, 29, 17, 4, 2, 1}, 12 },
-	{ {1978, 989, 86, 46, 43, 23, 2, 1}, 8 },
-	{ {1986, 993, 662, 331, 6, 3, 2, 1}, 8 },
-	{ {1992, 996, 664, 498, 332, 249, 166, 83, 24, 12, 8, 6, 4, 3, 2, 1}, 16 },
-	{ {1996, 998, 499, 4, 2, 1}, 6 },
-	{ {1998, 999, 666, 333, 222, 111, 74, 54, 37, 27, 18, 9, 6, 3, 2, 1}, 16 },
-	{ {2002, 1001, 286, 182, 154, 143, 91, 77, 26, 22, 14, 13, 11, 7, 2, 1}, 16 },
-	{ {2010, 1005, 670, 402, 335, 201, 134, 67, 30, 15, 10, 6, 5, 3, 2, 1}, 16 },
-	{ {2016, 1008, 672, 504, 336, 288, 252, 224, 168, 144, 126, 112, 96, 84, 72, 63, 56, 48, 42, 36, 32, 28, 24, 21, 18, 16, 14, 12, 9, 8, 7, 6, 4, 3, 2, 1}, 36 },
-	{ {2026, 1013, 2, 1}, 4 },
-	{ {2028, 1014, 676, 507, 338, 169, 156, 78, 52, 39, 26, 13, 12, 6, 4, 3, 2, 1}, 18 },
-	{ {2038, 1019, 2, 1}, 4 },
-	{ {2052, 1026, 684, 513, 342, 228, 171, 114, 108, 76, 57, 54, 38, 36, 27, 19, 18, 12, 9, 6, 4, 3, 2, 1}, 24 },
-	{ {2062, 1031, 2, 1}, 4 },
-	{ {2068, 1034, 517, 188, 94, 47, 44, 22, 11, 4, 2, 1}, 12 },
-	{ {2080, 1040, 520, 416, 260, 208, 160, 130, 104, 80, 65, 52, 40, 32, 26, 20, 16, 13, 10, 8, 5, 4, 2, 1}, 24 },
-	{ {2082, 1041, 694, 347, 6, 3, 2, 1}, 8 },
-	{ {2086, 1043, 298, 149, 14, 7, 2, 1}, 8 },
-	{ {2088, 1044, 696, 522, 348, 261, 232, 174, 116, 87, 72, 58, 36, 29, 24, 18, 12, 9, 8, 6, 4, 3, 2, 1}, 24 },
-	{ {2098, 1049, 2, 1}, 4 },
-	{ {2110, 1055, 422, 211, 10, 5, 2, 1}, 8 },
-	{ {2112, 1056, 704, 528, 352, 264, 192, 176, 132, 96, 88, 66, 64, 48, 44, 33, 32, 24, 22, 16, 12, 11, 8, 6, 4, 3, 2, 1}, 28 },
-	{ {2128, 1064, 532, 304, 266, 152, 133, 112, 76, 56, 38, 28, 19, 16, 14, 8, 7, 4, 2, 1}, 20 },
-	{ {2130, 1065, 710, 426, 355, 213, 142, 71, 30, 15, 10, 6, 5, 3, 2, 1}, 16 },
-	{ {2136, 1068, 712, 534, 356, 267, 178, 89, 24, 12, 8, 6, 4, 3, 2, 1}, 16 },
-	{ {2140, 1070, 535, 428, 214, 107, 20, 10, 5, 4, 2, 1}, 12 },
-	{ {2142, 1071, 714, 357, 306, 238, 153, 126, 119, 102, 63, 51, 42, 34, 21, 18, 17, 14, 9, 7, 6, 3, 2, 1}, 24 },
-	{ {2152, 1076, 538, 269, 8, 4, 2, 1}, 8 },
-	{ {2160, 1080, 720, 540, 432, 360, 270, 240, 216, 180, 144, 135, 120, 108, 90, 80, 72, 60, 54, 48, 45, 40, 36, 30, 27, 24, 20, 18, 16, 15, 12, 10, 9, 8, 6, 5, 4, 3, 2, 1}, 40 },
-	{ {2178, 1089, 726, 363, 242, 198, 121, 99, 66, 33, 22, 18, 11, 9, 6, 3, 2, 1}, 18 },
-	{ {2202, 1101, 734, 367, 6, 3, 2, 1}, 8 },
-	{ {2206, 1103, 2, 1}, 4 },
-	{ {2212, 1106, 553, 316, 158, 79, 28, 14, 7, 4, 2, 1}, 12 },
-	{ {2220, 1110, 740, 555, 444, 370, 222, 185, 148, 111, 74, 60, 37, 30, 20, 15, 12, 10, 6, 5, 4, 3, 2, 1}, 24 },
-	{ {2236, 1118, 559, 172, 86, 52, 43, 26, 13, 4, 2, 1}, 12 },
-	{ {2238, 1119, 746, 373, 6, 3, 2, 1}, 8 },
-	{ {2242, 1121, 118, 59, 38, 19, 2, 1}, 8 },
-	{ {2250, 1125, 750, 450, 375, 250, 225, 150, 125, 90, 75, 50, 45, 30, 25, 18, 15, 10, 9, 6, 5, 3, 2, 1}, 24 },
-	{ {2266, 1133, 206, 103, 22, 11, 2, 1}, 8 },
-	{ {2268, 1134, 756, 567, 378, 324, 252, 189, 162, 126, 108, 84, 81, 63, 54, 42, 36, 28, 27, 21, 18, 14, 12, 9, 7, 6, 4, 3, 2, 1}, 30 },
-	{ {2272, 1136, 568, 284, 142, 71, 32, 16, 8, 4, 2, 1}, 12 },
-	{ {2280, 1140, 760, 570, 456, 380, 285, 228, 190, 152, 120, 114, 95, 76, 60, 57, 40, 38, 30, 24, 20, 19, 15, 12, 10, 8, 6, 5, 4, 3, 2, 1}, 32 },
-	{ {2286, 1143, 762, 381, 254, 127, 18, 9, 6, 3, 2, 1}, 12 },
-	{ {2292, 1146, 764, 573, 382, 191, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {2296, 1148, 574, 328, 287, 164, 82, 56, 41, 28, 14, 8, 7, 4, 2, 1}, 16 },
-	{ {2308, 1154, 577, 4, 2, 1}, 6 },
-	{ {2310, 1155, 770, 462, 385, 330, 231, 210, 165, 154, 110, 105, 77, 70, 66, 55, 42, 35, 33, 30, 22, 21, 15, 14, 11, 10, 7, 6, 5, 3, 2, 1}, 32 },
-	{ {2332, 1166, 583, 212, 106, 53, 44, 22, 11, 4, 2, 1}, 12 },
-	{ {2338, 1169, 334, 167, 14, 7, 2, 1}, 8 },
-	{ {2340, 1170, 780, 585, 468, 390, 260, 234, 195, 180, 156, 130, 117, 90, 78, 65, 60, 52, 45, 39, 36, 30, 26, 20, 18, 15, 13, 12, 10, 9, 6, 5, 4, 3, 2, 1}, 36 },
-	{ {2346, 1173, 782, 391, 138, 102, 69, 51, 46, 34, 23, 17, 6, 3, 2, 1}, 16 },
-	{ {2350, 1175, 470, 235, 94, 50, 47, 25, 10, 5, 2, 1}, 12 },
-	{ {2356, 1178, 589, 124, 76, 62, 38, 31, 19, 4, 2, 1}, 12 },
-	{ {2370, 1185, 790, 474, 395, 237, 158, 79, 30, 15, 10, 6, 5, 3, 2, 1}, 16 },
-	{ {2376, 1188, 792, 594, 396, 297, 264, 216, 198, 132, 108, 99, 88, 72, 66, 54, 44, 36, 33, 27, 24, 22, 18, 12, 11, 9, 8, 6, 4, 3, 2, 1}, 32 },
-	{ {2380, 1190, 595, 476, 340, 238, 170, 140, 119, 85, 70, 68, 35, 34, 28, 20, 17, 14, 10, 7, 5, 4, 2, 1}, 24 },
-	{ {2382, 1191, 794, 397, 6, 3, 2, 1}, 8 },
-	{ {2388, 1194, 796, 597, 398, 199, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {2392, 1196, 598, 299, 184, 104, 92, 52, 46, 26, 23, 13, 8, 4, 2, 1}, 16 },
-	{ {2398, 1199, 218, 109, 22, 11, 2, 1}, 8 },
-	{ {2410, 1205, 482, 241, 10, 5, 2, 1}, 8 },
-	{ {2416, 1208, 604, 302, 151, 16, 8, 4, 2, 1}, 10 },
-	{ {2422, 1211, 346, 173, 14, 7, 2, 1}, 8 },
-	{ {2436, 1218, 812, 609, 406, 348, 203, 174, 116, 87, 84, 58, 42, 29, 28, 21, 14, 12, 7, 6, 4, 3, 2, 1}, 24 },
-	{ {2440, 1220, 610, 488, 305, 244, 122, 61, 40, 20, 10, 8, 5, 4, 2, 1}, 16 },
-	{ {2446, 1223, 2, 1}, 4 },
-	{ {2458, 1229, 2, 1}, 4 },
-	{ {2466, 1233, 822, 411, 274, 137, 18, 9, 6, 3, 2, 1}, 12 },
-	{ {2472, 1236, 824, 618, 412, 309, 206, 103, 24, 12, 8, 6, 4, 3, 2, 1}, 16 },
-	{ {2476, 1238, 619, 4, 2, 1}, 6 },
-	{ {2502, 1251, 834, 417, 278, 139, 18, 9, 6, 3, 2, 1}, 12 },
-	{ {2520, 1260, 840, 630, 504, 420, 360, 315, 280, 252, 210, 180, 168, 140, 126, 120, 105, 90, 84, 72, 70, 63, 60, 56, 45, 42, 40, 36, 35, 30, 28, 24, 21, 20, 18, 15, 14, 12, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1}, 48 },
-	{ {2530, 1265, 506, 253, 230, 115, 110, 55, 46, 23, 22, 11, 10, 5, 2, 1}, 16 },
-	{ {2538, 1269, 846, 423, 282, 141, 94, 54, 47, 27, 18, 9, 6, 3, 2, 1}, 16 },
-	{ {2542, 1271, 82, 62, 41, 31, 2, 1}, 8 },
-	{ {2548, 1274, 637, 364, 196, 182, 98, 91, 52, 49, 28, 26, 14, 13, 7, 4, 2, 1}, 18 },
-	{ {2550, 1275, 850, 510, 425, 255, 170, 150, 102, 85, 75, 51, 50, 34, 30, 25, 17, 15, 10, 6, 5, 3, 2, 1}, 24 },
-	{ {2556, 1278, 852, 639, 426, 284, 213, 142, 71, 36, 18, 12, 9, 6, 4, 3, 2, 1}, 18 },
-	{ {2578, 1289, 2, 1}, 4 },
-	{ {2590, 1295, 518, 370, 259, 185, 74, 70, 37, 35, 14, 10, 7, 5, 2, 1}, 16 },
-	{ {2592, 1296, 864, 648, 432, 324, 288, 216, 162, 144, 108, 96, 81, 72, 54, 48, 36, 32, 27, 24, 18, 16, 12, 9, 8, 6, 4, 3, 2, 1}, 30 },
-	{ {2608, 1304, 652, 326, 163, 16, 8, 4, 2, 1}, 10 },
-	{ {2616, 1308, 872, 654, 436, 327, 218, 109, 24, 12, 8, 6, 4, 3, 2, 1}, 16 },
-	{ {2620, 1310, 655, 524, 262, 131, 20, 10, 5, 4, 2, 1}, 12 },
-	{ {2632, 1316, 658, 376, 329, 188, 94, 56, 47, 28, 14, 8, 7, 4, 2, 1}, 16 },
-	{ {2646, 1323, 882, 441, 378, 294, 189, 147, 126, 98, 63, 54, 49, 42, 27, 21, 18, 14, 9, 7, 6, 3, 2, 1}, 24 },
-	{ {2656, 1328, 664, 332, 166, 83, 32, 16, 8, 4, 2, 1}, 12 },
-	{ {2658, 1329, 886, 443, 6, 3, 2, 1}, 8 },
-	{ {2662, 1331, 242, 121, 22, 11, 2, 1}, 8 },
-	{ {2670, 1335, 890, 534, 445, 267, 178, 89, 30, 15, 10, 6, 5, 3, 2, 1}, 16 },
-	{ {2676, 1338, 892, 669, 446, 223, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {2682, 1341, 894, 447, 298, 149, 18, 9, 6, 3, 2, 1}, 12 },
-	{ {2686, 1343, 158, 79, 34, 17, 2, 1}, 8 },
-	{ {2688, 1344, 896, 672, 448, 384, 336, 224, 192, 168, 128, 112, 96, 84, 64, 56, 48, 42, 32, 28, 24, 21, 16, 14, 12, 8, 7, 6, 4, 3, 2, 1}, 32 },
-	{ {2692, 1346, 673, 4, 2, 1}, 6 },
-	{ {2698, 1349, 142, 71, 38, 19, 2, 1}, 8 },
-	{ {2706, 1353, 902, 451, 246, 123, 82, 66, 41, 33, 22, 11, 6, 3, 2, 1}, 16 },
-	{ {2710, 1355, 542, 271, 10, 5, 2, 1}, 8 },
-	{ {2712, 1356, 904, 678, 452, 339, 226, 113, 24, 12, 8, 6, 4, 3, 2, 1}, 16 },
-	{ {2718, 1359, 906, 453, 302, 151, 18, 9, 6, 3, 2, 1}, 12 },
-	{ {2728, 1364, 682, 341, 248, 124, 88, 62, 44, 31, 22, 11, 8, 4, 2, 1}, 16 },
-	{ {2730, 1365, 910, 546, 455, 390, 273, 210, 195, 182, 130, 105, 91, 78, 70, 65, 42, 39, 35, 30, 26, 21, 15, 14, 13, 10, 7, 6, 5, 3, 2, 1}, 32 },
-	{ {2740, 1370, 685, 548, 274, 137, 20, 10, 5, 4, 2, 1}, 12 },
-	{ {2748, 1374, 916, 687, 458, 229, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {2752, 1376, 688, 344, 172, 86, 64, 43, 32, 16, 8, 4, 2, 1}, 14 },
-	{ {2766, 1383, 922, 461, 6, 3, 2, 1}, 8 },
-	{ {2776, 1388, 694, 347, 8, 4, 2, 1}, 8 },
-	{ {2788, 1394, 697, 164, 82, 68, 41, 34, 17, 4, 2, 1}, 12 },
-	{ {2790, 1395, 930, 558, 465, 310, 279, 186, 155, 93, 90, 62, 45, 31, 30, 18, 15, 10, 9, 6, 5, 3, 2, 1}, 24 },
-	{ {2796, 1398, 932, 699, 466, 233, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {2800, 1400, 700, 560, 400, 350, 280, 200, 175, 140, 112, 100, 80, 70, 56, 50, 40, 35, 28, 25, 20, 16, 14, 10, 8, 7, 5, 4, 2, 1}, 30 },
-	{ {2802, 1401, 934, 467, 6, 3, 2, 1}, 8 },
-	{ {2818, 1409, 2, 1}, 4 },
-	{ {2832, 1416, 944, 708, 472, 354, 236, 177, 118, 59, 48, 24, 16, 12, 8, 6, 4, 3, 2, 1}, 20 },
-	{ {2836, 1418, 709, 4, 2, 1}, 6 },
-	{ {2842, 1421, 406, 203, 98, 58, 49, 29, 14, 7, 2, 1}, 12 },
-	{ {2850, 1425, 950, 570, 475, 285, 190, 150, 114, 95, 75, 57, 50, 38, 30, 25, 19, 15, 10, 6, 5, 3, 2, 1}, 24 },
-	{ {2856, 1428, 952, 714, 476, 408, 357, 238, 204, 168, 136, 119, 102, 84, 68, 56, 51, 42, 34, 28, 24, 21, 17, 14, 12, 8, 7, 6, 4, 3, 2, 1}, 32 },
-	{ {2860, 1430, 715, 572, 286, 260, 220, 143, 130, 110, 65, 55, 52, 44, 26, 22, 20, 13, 11, 10, 5, 4, 2, 1}, 24 },
-	{ {2878, 1439, 2, 1}, 4 },
-	{ {2886, 1443, 962, 481, 222, 111, 78, 74, 39, 37, 26, 13, 6, 3, 2, 1}, 16 },
-	{ {2896, 1448, 724, 362, 181, 16, 8, 4, 2, 1}, 10 },
-	{ {2902, 1451, 2, 1}, 4 },
-	{ {2908, 1454, 727, 4, 2, 1}, 6 },
-	{ {2916, 1458, 972, 729, 486, 324, 243, 162, 108, 81, 54, 36, 27, 18, 12, 9, 6, 4, 3, 2, 1}, 21 },
-	{ {2926, 1463, 418, 266, 209, 154, 133, 77, 38, 22, 19, 14, 11, 7, 2, 1}, 16 },
-	{ {2938, 1469, 226, 113, 26, 13, 2, 1}, 8 },
-	{ {2952, 1476, 984, 738, 492, 369, 328, 246, 164, 123, 82, 72, 41, 36, 24, 18, 12, 9, 8, 6, 4, 3, 2, 1}, 24 },
-	{ {2956, 1478, 739, 4, 2, 1}, 6 },
-	{ {2962, 1481, 2, 1}, 4 },
-	{ {2968, 1484, 742, 424, 371, 212, 106, 56, 53, 28, 14, 8, 7, 4, 2, 1}, 16 },
-	{ {2970, 1485, 990, 594, 495, 330, 297, 270, 198, 165, 135, 110, 99, 90, 66, 55, 54, 45, 33, 30, 27, 22, 18, 15, 11, 10, 9, 6, 5, 3, 2, 1}, 32 },
-	{ {2998, 1499, 2, 1}, 4 },
-	{ {3000, 1500, 1000, 750, 600, 500, 375, 300, 250, 200, 150, 125, 120, 100, 75, 60, 50, 40, 30, 25, 24, 20, 15, 12, 10, 8, 6, 5, 4, 3, 2, 1}, 32 },
-	{ {3010, 1505, 602, 430, 301, 215, 86, 70, 43, 35, 14, 10, 7, 5, 2, 1}, 16 },
-	{ {3018, 1509, 1006, 503, 6, 3, 2, 1}, 8 },
-	{ {3022, 1511, 2, 1}, 4 },
-	{ {3036, 1518, 1012, 759, 506, 276, 253, 138, 132, 92, 69, 66, 46, 44, 33, 23, 22, 12, 11, 6, 4, 3, 2, 1}, 24 },
-	{ {3040, 1520, 760, 608, 380, 304, 190, 160, 152, 95, 80, 76, 40, 38, 32, 20, 19, 16, 10, 8, 5, 4, 2, 1}, 24 },
-	{ {3048, 1524, 1016, 762, 508, 381, 254, 127, 24, 12, 8, 6, 4, 3, 2, 1}, 16 },
-	{ {3060, 1530, 1020, 765, 612, 510, 340, 306, 255, 204, 180, 170, 153, 102, 90, 85, 68, 60, 51, 45, 36, 34, 30, 20, 18, 17, 15, 12, 10, 9, 6, 5, 4, 3, 2, 1}, 36 },
-	{ {3066, 1533, 1022, 511, 438, 219, 146, 73, 42, 21, 14, 7, 6, 3, 2, 1}, 16 },
-	{ {3078, 1539, 1026, 513, 342, 171, 162, 114, 81, 57, 54, 38, 27, 19, 18, 9, 6, 3, 2, 1}, 20 },
-	{ {3082, 1541, 134, 67, 46, 23, 2, 1}, 8 },
-	{ {3088, 1544, 772, 386, 193, 16, 8, 4, 2, 1}, 10 },
-	{ {3108, 1554, 1036, 777, 518, 444, 259, 222, 148, 111, 84, 74, 42, 37, 28, 21, 14, 12, 7, 6, 4, 3, 2, 1}, 24 },
-	{ {3118, 1559, 2, 1}, 4 },
-	{ {3120, 1560, 1040, 780, 624, 520, 390, 312, 260, 240, 208, 195, 156, 130, 120, 104, 80, 78, 65, 60, 52, 48, 40, 39, 30, 26, 24, 20, 16, 15, 13, 12, 10, 8, 6, 5, 4, 3, 2, 1}, 40 },
-	{ {3136, 1568, 784, 448, 392, 224, 196, 112, 98, 64, 56, 49, 32, 28, 16, 14, 8, 7, 4, 2, 1}, 21 },
-	{ {3162, 1581, 1054, 527, 186, 102, 93, 62, 51, 34, 31, 17, 6, 3, 2, 1}, 16 },
-	{ {3166, 1583, 2, 1}, 4 },
-	{ {3168, 1584, 1056, 792, 528, 396, 352, 288, 264, 198, 176, 144, 132, 99, 96, 88, 72, 66, 48, 44, 36, 33, 32, 24, 22, 18, 16, 12, 11, 9, 8, 6, 4, 3, 2, 1}, 36 },
-	{ {3180, 1590, 1060, 795, 636, 530, 318, 265, 212, 159, 106, 60, 53, 30, 20, 15, 12, 10, 6, 5, 4, 3, 2, 1}, 24 },
-	{ {3186, 1593, 1062, 531, 354, 177, 118, 59, 54, 27, 18, 9, 6, 3, 2, 1}, 16 },
-	{ {3190, 1595, 638, 319, 290, 145, 110, 58, 55, 29, 22, 11, 10, 5, 2, 1}, 16 },
-	{ {3202, 1601, 2, 1}, 4 },
-	{ {3208, 1604, 802, 401, 8, 4, 2, 1}, 8 },
-	{ {3216, 1608, 1072, 804, 536, 402, 268, 201, 134, 67, 48, 24, 16, 12, 8, 6, 4, 3, 2, 1}, 20 },
-	{ {3220, 1610, 805, 644, 460, 322, 230, 161, 140, 115, 92, 70, 46, 35, 28, 23, 20, 14, 10, 7, 5, 4, 2, 1}, 24 },
-	{ {3228, 1614, 1076, 807, 538, 269, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {3250, 1625, 650, 325, 250, 130, 125, 65, 50, 26, 25, 13, 10, 5, 2, 1}, 16 },
-	{ {3252, 1626, 1084, 813, 542, 271, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {3256, 1628, 814, 407, 296, 148, 88, 74, 44, 37, 22, 11, 8, 4, 2, 1}, 16 },
-	{ {3258, 1629, 1086, 543, 362, 181, 18, 9, 6, 3, 2, 1}, 12 },
-	{ {3270, 1635, 1090, 654, 545, 327, 218, 109, 30, 15, 10, 6, 5, 3, 2, 1}, 16 },
-	{ {3298, 1649, 194, 97, 34, 17, 2, 1}, 8 },
-	{ {3300, 1650, 1100, 825, 660, 550, 330, 300, 275, 220, 165, 150, 132, 110, 100, 75, 66, 60, 55, 50, 44, 33, 30, 25, 22, 20, 15, 12, 11, 10, 6, 5, 4, 3, 2, 1}, 36 },
-	{ {3306, 1653, 1102, 551, 174, 114, 87, 58, 57, 38, 29, 19, 6, 3, 2, 1}, 16 },
-	{ {3312, 1656, 1104, 828, 552, 414, 368, 276, 207, 184, 144, 138, 92, 72, 69, 48, 46, 36, 24, 23, 18, 16, 12, 9, 8, 6, 4, 3, 2, 1}, 30 },
-	{ {3318, 1659, 1106, 553, 474, 237, 158, 79, 42, 21, 14, 7, 6, 3, 2, 1}, 16 },
-	{ {3322, 1661, 302, 151, 22, 11, 2, 1}, 8 },
-	{ {3328, 1664, 832, 416, 256, 208, 128, 104, 64, 52, 32, 26, 16, 13, 8, 4, 2, 1}, 18 },
-	{ {3330, 1665, 1110, 666, 555, 370, 333, 222, 185, 111, 90, 74, 45, 37, 30, 18, 15, 10, 9, 6, 5, 3, 2, 1}, 24 },
-	{ {3342, 1671, 1114, 557, 6, 3, 2, 1}, 8 },
-	{ {3346, 1673, 478, 239, 14, 7, 2, 1}, 8 },
-	{ {3358, 1679, 146, 73, 46, 23, 2, 1}, 8 },
-	{ {3360, 1680, 1120, 840, 672, 560, 480, 420, 336, 280, 240, 224, 210, 168, 160, 140, 120, 112, 105, 96, 84, 80, 70, 60, 56, 48, 42, 40, 35, 32, 30, 28, 24, 21, 20, 16, 15, 14, 12, 10, 8, 7, 6, 5, 4, 3, 2, 1}, 48 },
-	{ {3370, 1685, 674, 337, 10, 5, 2, 1}, 8 },
-	{ {3372, 1686, 1124, 843, 562, 281, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {3388, 1694, 847, 484, 308, 242, 154, 121, 77, 44, 28, 22, 14, 11, 7, 4, 2, 1}, 18 },
-	{ {3390, 1695, 1130, 678, 565, 339, 226, 113, 30, 15, 10, 6, 5, 3, 2, 1}, 16 },
-	{ {3406, 1703, 262, 131, 26, 13, 2, 1}, 8 },
-	{ {3412, 1706, 853, 4, 2, 1}, 6 },
-	{ {3432, 1716, 1144, 858, 572, 429, 312, 286, 264, 156, 143, 132, 104, 88, 78, 66, 52, 44, 39, 33, 26, 24, 22, 13, 12, 11, 8, 6, 4, 3, 2, 1}, 32 },
-	{ {3448, 1724, 862, 431, 8, 4, 2, 1}, 8 },
-	{ {3456, 1728, 1152, 864, 576, 432, 384, 288, 216, 192, 144, 128, 108, 96, 72, 64, 54, 48, 36, 32, 27, 24, 18, 16, 12, 9, 8, 6, 4, 3, 2, 1}, 32 },
-	{ {3460, 1730, 865, 692, 346, 173, 20, 10, 5, 4, 2, 1}, 12 },
-	{ {3462, 1731, 1154, 577, 6, 3, 2, 1}, 8 },
-	{ {3466, 1733, 2, 1}, 4 },
-	{ {3468, 1734, 1156, 867, 578, 289, 204, 102, 68, 51, 34, 17, 12, 6, 4, 3, 2, 1}, 18 },
-	{ {3490, 1745, 698, 349, 10, 5, 2, 1}, 8 },
-	{ {3498, 1749, 1166, 583, 318, 159, 106, 66, 53, 33, 22, 11, 6, 3, 2, 1}, 16 },
-	{ {3510, 1755, 1170, 702, 585, 390, 351, 270, 234, 195, 135, 130, 117, 90, 78, 65, 54, 45, 39, 30, 27, 26, 18, 15, 13, 10, 9, 6, 5, 3, 2, 1}, 32 },
-	{ {3516, 1758, 1172, 879, 586, 293, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {3526, 1763, 86, 82, 43, 41, 2, 1}, 8 },
-	{ {3528, 1764, 1176, 882, 588, 504, 441, 392, 294, 252, 196, 168, 147, 126, 98, 84, 72, 63, 56, 49, 42, 36, 28, 24, 21, 18, 14, 12, 9, 8, 7, 6, 4, 3, 2, 1}, 36 },
-	{ {3532, 1766, 883, 4, 2, 1}, 6 },
-	{ {3538, 1769, 122, 61, 58, 29, 2, 1}, 8 },
-	{ {3540, 1770, 1180, 885, 708, 590, 354, 295, 236, 177, 118, 60, 59, 30, 20, 15, 12, 10, 6, 5, 4, 3, 2, 1}, 24 },
-	{ {3546, 1773, 1182, 591, 394, 197, 18, 9, 6, 3, 2, 1}, 12 },
-	{ {3556, 1778, 889, 508, 254, 127, 28, 14, 7, 4, 2, 1}, 12 },
-	{ {3558, 1779, 1186, 593, 6, 3, 2, 1}, 8 },
-	{ {3570, 1785, 1190, 714, 595, 510, 357, 255, 238, 210, 170, 119, 105, 102, 85, 70, 51, 42, 35, 34, 30, 21, 17, 15, 14, 10, 7, 6, 5, 3, 2, 1}, 32 },
-	{ {3580, 1790, 895, 716, 358, 179, 20, 10, 5, 4, 2, 1}, 12 },
-	{ {3582, 1791, 1194, 597, 398, 199, 18, 9, 6, 3, 2, 1}, 12 },
-	{ {3592, 1796, 898, 449, 8, 4, 2, 1}, 8 },
-	{ {3606, 1803, 1202, 601, 6, 3, 2, 1}, 8 },
-	{ {3612, 1806, 1204, 903, 602, 516, 301, 258, 172, 129, 86, 84, 43, 42, 28, 21, 14, 12, 7, 6, 4, 3, 2, 1}, 24 },
-	{ {3616, 1808, 904, 452, 226, 113, 32, 16, 8, 4, 2, 1}, 12 },
-	{ {3622, 1811, 2, 1}, 4 },
-	{ {3630, 1815, 1210, 726, 605, 363, 330, 242, 165, 121, 110, 66, 55, 33, 30, 22, 15, 11, 10, 6, 5, 3, 2, 1}, 24 },
-	{ {3636, 1818, 1212, 909, 606, 404, 303, 202, 101, 36, 18, 12, 9, 6, 4, 3, 2, 1}, 18 },
-	{ {3642, 1821, 1214, 607, 6, 3, 2, 1}, 8 },
-	{ {3658, 1829, 118, 62, 59, 31, 2, 1}, 8 },
-	{ {3670, 1835, 734, 367, 10, 5, 2, 1}, 8 },
-	{ {3672, 1836, 1224, 918, 612, 459, 408, 306, 216, 204, 153, 136, 108, 102, 72, 68, 54, 51, 36, 34, 27, 24, 18, 17, 12, 9, 8, 6, 4, 3, 2, 1}, 32 },
-	{ {3676, 1838, 919, 4, 2, 1}, 6 },
-	{ {3690, 1845, 1230, 738, 615, 410, 369, 246, 205, 123, 90, 82, 45, 41, 30, 18, 15, 10, 9, 6, 5, 3, 2, 1}, 24 },
-	{ {3696, 1848, 1232, 924, 616, 528, 462, 336, 308, 264, 231, 176, 168, 154, 132, 112, 88, 84, 77, 66, 56, 48, 44, 42, 33, 28, 24, 22, 21, 16, 14, 12, 11, 8, 7, 6, 4, 3, 2, 1}, 40 },
-	{ {3700, 1850, 925, 740, 370, 185, 148, 100, 74, 50, 37, 25, 20, 10, 5, 4, 2, 1}, 18 },
-	{ {3708, 1854, 1236, 927, 618, 412, 309, 206, 103, 36, 18, 12, 9, 6, 4, 3, 2, 1}, 18 },
-	{ {3718, 1859, 338, 286, 169, 143, 26, 22, 13, 11, 2, 1}, 12 },
-	{ {3726, 1863, 1242, 621, 414, 207, 162, 138, 81, 69, 54, 46, 27, 23, 18, 9, 6, 3, 2, 1}, 20 },
-	{ {3732, 1866, 1244, 933, 622, 311, 12, 6, 4, 3, 2, 1}, 12 },
-	{ {3738, 1869, 1246, 623, 534, 267, 178, 89, 42, 21, 14, 7, 6, 3, 2, 1}, 16 },
-	{ {3760, 1880, 940, 752, 470, 376, 235, 188, 94, 80, 47, 40, 20, 16, 10, 8, 5, 4, 2, 1}, 20 },
-	{ {3766, 1883, 538, 269, 14, 7, 2, 1}, 8 },
-	{ {3768, 1884, 1256, 942, 628, 471, 314, 157, 24, 12, 8, 6, 4, 3, 2, 1}, 16 },
-	{ {3778, 1889, 2, 1}, 4 },
-	{ {3792, 1896, 1264, 948, 632, 474, 316, 237, 158, 79, 48, 24, 16, 12, 8, 6, 4, 3, 2, 1}, 20 },
-	{ {3796, 1898, 949, 292, 146, 73, 52, 26, 13, 4, 2, 1}, 12 },
-	{ {3802, 1901, 2, 1}, 4 },
-	{ {3820, 1910, 955, 764, 382, 191, 20, 10, 5, 4, 2, 1}, 12 },
-	{ {3822, 1911, 1274, 637, 546, 294, 273, 182, 147, 98, 91, 78, 49, 42, 39, 26, 21, 14, 13, 7, 6, 3, 2, 1}, 24 },
-	{ {3832, 1916, 958, 479, 8, 4, 2, 1}, 8 },
-	{ {3846, 1923, 1282, 641, 6, 3, 2, 1}, 8 },
-	{ {3850, 1925, 770, 550, 385, 350, 275, 175, 154, 110, 77, 70, 55, 50, 35, 25, 22, 14, 11, 10, 7, 5, 2, 1}, 24 },
-	{ {3852, 1926, 1284, 963, 642, 428, 321, 214, 107, 36, 18, 12, 9, 6, 4, 3, 2, 1}, 18 },
-	{ {3862, 1931, 2, 1}, 4 },
-	{ {3876, 1938, 1292, 969, 646, 323, 228, 204, 114, 102, 76, 68, 57, 51, 38, 34, 19, 17, 12, 6, 4, 3, 2, 1}, 24 },
-	{ {3880, 1940, 970, 776, 485, 388, 194, 97, 40, 20, 10, 8, 5, 4, 2, 1}, 16 },
-	{ {3888, 1944, 1296, 972, 648, 486, 432, 324, 243, 216, 162, 144, 108, 81, 72, 54, 48, 36, 27, 24, 18, 16, 12, 9, 8, 6, 4, 3, 2, 1}, 30 },
-	{ {3906, 1953, 1302, 651, 558, 434, 279, 217, 186, 126, 93, 63, 62, 42, 31, 21, 18, 14, 9, 7, 6, 3, 2, 1}, 24 },
-	{ {3910, 1955, 782, 391, 230, 170, 115, 85, 46, 34, 23, 17, 10, 5, 2, 1}, 16 },
-	{ {3916, 1958, 979, 356, 178, 89, 44, 22, 11, 4, 2, 1}, 12 },
-	{ {3918, 1959, 1306, 653, 6, 3, 2, 1}, 8 },
-	{ {3922, 1961, 106, 74, 53, 37, 2, 1}, 8 },
-	{ {3928, 1964, 982, 491, 8, 4, 2, 1}, 8 },
-	{ {3930, 1965, 1310, 786, 655, 393, 262, 131, 30, 15, 10, 6, 5, 3, 2, 1}, 16 },
-	{ {3942, 1971, 1314, 657, 438, 219, 146, 73, 54, 27, 18, 9, 6, 3, 2, 1}, 16 },
-	{ {3946, 1973, 2, 1}, 4 },
-	{ {3966, 1983, 1322, 661, 6, 3, 2, 1}, 8 },
-	{ {3988, 1994, 997, 4, 2, 1}, 6 },
-	{ {4000, 2000, 1000, 800, 500, 400, 250, 200, 160, 125, 100, 80, 50, 40, 32, 25, 20, 16, 10, 8, 5, 4, 2, 1}, 24 },
-	{ {4002, 2001, 1334, 667, 174, 138, 87, 69, 58, 46, 29, 23, 6, 3, 2, 1}, 16 },
-	{ {4006, 2003, 2, 1}, 4 },
-	{ {4012, 2006, 1003, 236, 118, 68, 59, 34, 17, 4, 2, 1}, 12 },
-	{ {4018, 2009, 574, 287, 98, 82, 49, 41, 14, 7, 2, 1}, 12 },
-	{ {4020, 2010, 1340, 1005, 804, 670, 402, 335, 268, 201, 134, 67, 60, 30, 20, 15, 12, 10, 6, 5, 4, 3, 2, 1}, 24 },
-	{ {4026, 2013, 1342, 671, 366, 183, 122, 66, 61, 33, 22, 11, 6, 3, 2, 1}, 16 },
-	{ {4048, 2024, 1012, 506, 368, 253, 184, 176, 92, 88, 46, 44, 23, 22, 16, 11, 8, 4, 2, 1}, 20 },
-	{ {4050, 2025, 1350, 810, 675, 450, 405, 270, 225, 162, 150, 135, 90, 81, 75, 54, 50, 45, 30, 27, 25, 18, 15, 10, 9, 6, 5, 3, 2, 1}, 30 },
-	{ {4056, 2028, 1352, 1014, 676, 507, 338, 312, 169, 156, 104, 78, 52, 39, 26, 24, 13, 12, 8, 6, 4, 3, 2, 1}, 24 },
-	{ {4072, 2036, 1018, 509, 8, 4, 2, 1}, 8 },
-	{ {4078, 2039, 2, 1}, 4 },
-	{ {4090, 2045, 818, 409, 10, 5, 2, 1}, 8 },
-	{ {4092, 2046, 1364, 1023, 682, 372, 341, 186, 132, 124, 93, 66, 62, 44, 33, 31, 22, 12, 11, 6, 4, 3, 2, 1}, 24 }
+/* divisors of phi(p)=p-1 for small primes, in decreasing order: the divisors of
+ * primes[i] are phi_divisors[phi_divisors_offset[i] ... phi_divisors_offset[i+1]-1] */
+unsigned int phi_divisors[MAXPHIDIVISORSTOTAL] = {
+	2, 1,
+	4, 2, 1,
+	6, 3, 2, 1,
+	10, 5, 2, 1,
+	12, 6, 4, 3, 2, 1,
+	16, 8, 4, 2, 1,
+	18, 9, 6, 3, 2, 1,
+	22, 11, 2, 1,
+	28, 14, 7, 4, 2, 1,
+	30, 15, 10, 6, 5, 3, 2, 1,
+	36, 18, 12, 9, 6, 4, 3, 2, 1,
+	40, 20, 10, 8, 5, 4, 2, 1,
+	42, 21, 14, 7, 6, 3, 2, 1,
+	46, 23, 2, 1,
+	52, 26, 13, 4, 2, 1,
+	58, 29, 2, 1,
+	60, 30, 20, 15, 12, 10, 6, 5, 4, 3, 2, 1,
+	66, 33, 22, 11, 6, 3, 2, 1,
+	70, 35, 14, 10, 7, 5, 2, 1,
+	72, 36, 24, 18, 12, 9, 8, 6, 4, 3, 2, 1,
+	78, 39, 26, 13, 6, 3, 2, 1,
+	82, 41, 2, 1,
+	88, 44, 22, 11, 8, 4, 2, 1,
+	96, 48, 32, 24, 16, 12, 8, 6, 4, 3, 2, 1,
+	100, 50, 25, 20, 10, 5, 4, 2, 1,
+	102, 51, 34, 17, 6, 3, 2, 1,
+	106, 53, 2, 1,
+	108, 54, 36, 27, 18, 12, 9, 6, 4, 3, 2, 1,
+	112, 56, 28, 16, 14, 8, 7, 4, 2, 1,
+	126, 63, 42, 21, 18, 14, 9, 7, 6, 3, 2, 1,
+	130, 65, 26, 13, 10, 5, 2, 1,
+	136, 68, 34, 17, 8, 4, 2, 1,
+	138, 69, 46, 23, 6, 3, 2, 1,
+	148, 74, 37, 4, 2, 1,
+	150, 75, 50, 30, 25, 15, 10, 6, 5, 3, 2, 1,
+	156, 78, 52, 39, 26, 13, 12, 6, 4, 3, 2, 1,
+	162, 81, 54, 27, 18, 9, 6, 3, 2, 1,
+	166, 83, 2, 1,
+	172, 86, 43, 4, 2, 1,
+	178, 89, 2, 1,
+	180, 90, 60, 45, 36, 30, 20, 18, 15, 12, 10, 9, 6, 5, 4, 3, 2, 1,
+	190, 95, 38, 19, 10, 5, 2, 1,
+	192, 96, 64, 48, 32, 24, 16, 12, 8, 6, 4, 3, 2, 1,
+	196, 98, 49, 28, 14, 7, 4, 2, 1,
+	198, 99, 66, 33, 22, 18, 11, 9, 6, 3, 2, 1,
+	210, 105, 70, 42, 35, 30, 21, 15, 14, 10, 7, 6, 5, 3, 2, 1,
+	222, 111, 74, 37, 6, 3, 2, 1,
+	226, 113, 2, 1,
+	228, 114, 76, 57, 38, 19, 12, 6, 4, 3, 2, 1,
+	232, 116, 58, 29, 8, 4, 2, 1,
+	238, 119, 34, 17, 14, 7, 2, 1,
+	240, 120, 80, 60, 48, 40, 30, 24, 20, 16, 15, 12, 10, 8, 6, 5, 4, 3, 2, 1,
+	250, 125, 50, 25, 10, 5, 2, 1,
+	256, 128, 64, 32, 16, 8, 4, 2, 1,
+	262, 131, 2, 1,
+	268, 134, 67, 4, 2, 1,
+	270, 135, 90, 54, 45, 30, 27, 18, 15, 10, 9, 6, 5, 3, 2, 1,
+	276, 138, 92, 69, 46, 23, 12, 6, 4, 3, 2, 1,
+	280, 140, 70, 56, 40, 35, 28, 20, 14, 10, 8, 7, 5, 4, 2, 1,
+	282, 141, 94, 47, 6, 3, 2, 1,
+	292, 146, 73, 4, 2, 1,
+	306, 153, 102, 51, 34, 18, 17, 9, 6, 3, 2, 1,
+	310, 155, 62, 31, 10, 5, 2, 1,
+	312, 156, 104, 78, 52, 39, 26, 24, 13, 12, 8, 6, 4, 3, 2, 1,
+	316, 158, 79, 4, 2, 1,
+	330, 165, 110, 66, 55, 33, 30, 22, 15, 11, 10, 6, 5, 3, 2, 1,
+	336, 168, 112, 84, 56, 48, 42, 28, 24, 21, 16, 14, 12, 8, 7, 6, 4, 3, 2, 1,
+	346, 173, 2, 1,
+	348, 174, 116, 87, 58, 29, 12, 6, 4, 3, 2, 1,
+	352, 176, 88, 44, 32, 22, 16, 11, 8, 4, 2, 1,
+	358, 179, 2, 1,
+	366, 183, 122, 61, 6, 3, 2, 1,
+	372, 186, 124, 93, 62, 31, 12, 6, 4, 3, 2, 1,
+	378, 189, 126, 63, 54, 42, 27, 21, 18, 14, 9, 7, 6, 3, 2, 1,
+	382, 191, 2, 1,
+	388, 194, 97, 4, 2, 1,
+	396, 198, 132, 99, 66, 44, 36, 33, 22, 18, 12, 11, 9, 6, 4, 3, 2, 1,
+	400, 200, 100, 80, 50, 40, 25, 20, 16, 10, 8, 5, 4, 2, 1,
+	408, 204, 136, 102, 68, 51, 34, 24, 17, 12, 8, 6, 4, 3, 2, 1,
+	418, 209, 38, 22, 19, 11, 2, 1,
+	420, 210, 140, 105, 84, 70, 60, 42, 35, 30, 28, 21, 20, 15, 14, 12, 10, 7, 6, 5, 4, 3, 2, 1,
+	430, 215, 86, 43, 10, 5, 2, 1,
+	432, 216, 144, 108, 72, 54, 48, 36, 27, 24, 18, 16, 12, 9, 8, 6, 4, 3, 2, 1,
+	438, 219, 146, 73, 6, 3, 2, 1,
+	442, 221, 34, 26, 17, 13, 2, 1,
+	448, 224, 112, 64, 56, 32, 28, 16, 14, 8, 7, 4, 2, 1,
+	456, 228, 152, 114, 76, 57, 38, 24, 19, 12, 8, 6, 4, 3, 2, 1,
+	460, 230, 115, 92, 46, 23, 20, 10, 5, 4, 2, 1,
+	462, 231, 154, 77, 66, 42, 33, 22, 21, 14, 11, 7, 6, 3, 2, 1,
+	466, 233, 2, 1,
+	478, 239, 2, 1,
+	486, 243, 162, 81, 54, 27, 18, 9, 6, 3, 2, 1,
+	490, 245, 98, 70, 49, 35, 14, 10, 7, 5, 2, 1,
+	498, 249, 166, 83, 6, 3, 2, 1,
+	502, 251, 2, 1,
+	508, 254, 127, 4, 2, 1,
+	520, 260, 130, 104, 65, 52, 40, 26, 20, 13, 10, 8, 5, 4, 2, 1,
+	522, 261, 174, 87, 58, 29, 18, 9, 6, 3, 2, 1,
+	540, 270, 180, 135, 108, 90, 60, 54, 45, 36, 30, 27, 20, 18, 15, 12, 10, 9, 6, 5, 4, 3, 2, 1,
+	546, 273, 182, 91, 78, 42, 39, 26, 21, 14, 13, 7, 6, 3, 2, 1,
+	556, 278, 139, 4, 2, 1,
+	562, 281, 2, 1,
+	568, 284, 142, 71, 8, 4, 2, 1,
+	570, 285, 190, 114, 95, 57, 38, 30, 19, 15, 10, 6, 5, 3, 2, 1,
+	576, 288, 192, 144, 96, 72, 64, 48, 36, 32, 24, 18, 16, 12, 9, 8, 6, 4, 3, 2, 1,
+	586, 293, 2, 1,
+	592, 296, 148, 74, 37, 16, 8, 4, 2, 1,
+	598, 299, 46, 26, 23, 13, 2, 1,
+	600, 300, 200, 150, 120, 100, 75, 60, 50, 40, 30, 25, 24, 20, 15, 12, 10, 8, 6, 5, 4, 3, 2, 1,
+	606, 303, 202, 101, 6, 3, 2, 1,
+	612, 306, 204, 153, 102, 68, 51, 36, 34, 18, 17, 12, 9, 6, 4, 3, 2, 1,
+	616, 308, 154, 88, 77, 56, 44, 28, 22, 14, 11, 8, 7, 4, 2, 1,
+	618, 309, 206, 103, 6, 3, 2, 1,
+	630, 315, 210, 126, 105, 90, 70, 63, 45, 42, 35, 30, 21, 18, 15, 14, 10, 9, 7, 6, 5, 3, 2, 1,
+	640, 320, 160, 128, 80, 64, 40, 32, 20, 16, 10, 8, 5, 4, 2, 1,
+	642, 321, 214, 107, 6, 3, 2, 1,
+	646, 323, 38, 34, 19, 17, 2, 1,
+	652, 326, 163, 4, 2, 1,
+	658, 329, 94, 47, 14, 7, 2, 1,
+	660, 330, 220, 165, 132, 110, 66, 60, 55, 44, 33, 30, 22, 20, 15, 12, 11, 10, 6, 5, 4, 3, 2, 1,
+	672, 336, 224, 168, 112, 96, 84, 56, 48, 42, 32, 28, 24, 21, 16, 14, 12, 8, 7, 6, 4, 3, 2, 1,
+	676, 338, 169, 52, 26, 13, 4, 2, 1,
+	682, 341, 62, 31, 22, 11, 2, 1,
+	690, 345, 230, 138, 115, 69, 46, 30, 23, 15, 10, 6, 5, 3, 2, 1,
+	700, 350, 175, 140, 100, 70, 50, 35, 28, 25, 20, 14, 10, 7, 5, 4, 2, 1,
+	708, 354, 236, 177, 118, 59, 12, 6, 4, 3, 2, 1,
+	718, 359, 2, 1,
+	726, 363, 242, 121, 66, 33, 22, 11, 6, 3, 2, 1,
+	732, 366, 244, 183, 122, 61, 12, 6, 4, 3, 2, 1,
+	738, 369, 246, 123, 82, 41, 18, 9, 6, 3, 2, 1,
+	742, 371, 106, 53, 14, 7, 2, 1,
+	750, 375, 250, 150, 125, 75, 50, 30, 25, 15, 10, 6, 5, 3, 2, 1,
+	756, 378, 252, 189, 126, 108, 84, 63, 54, 42, 36, 28, 27, 21, 18, 14, 12, 9, 7, 6, 4, 3, 2, 1,
+	760, 380, 190, 152, 95, 76, 40, 38, 20, 19, 10, 8, 5, 4, 2, 1,
+	768, 384, 256, 192, 128, 96, 64, 48, 32, 24, 16, 12, 8, 6, 4, 3, 2, 1,
+	772, 386, 193, 4, 2, 1,
+	786, 393, 262, 131, 6, 3, 2, 1,
+	796, 398, 199, 4, 2, 1,
+	808, 404, 202, 101, 8, 4, 2, 1,
+	810, 405, 270, 162, 135, 90, 81, 54, 45, 30, 27, 18, 15, 10, 9, 6, 5, 3, 2, 1,
+	820, 410, 205, 164, 82, 41, 20, 10, 5, 4, 2, 1,
+	822, 411, 274, 137, 6, 3, 2, 1,
+	826, 413, 118, 59, 14, 7, 2, 1,
+	828, 414, 276, 207, 138, 92, 69, 46, 36, 23, 18, 12, 9, 6, 4, 3, 2, 1,
+	838, 419, 2, 1,
+	852, 426, 284, 213, 142, 71, 12, 6, 4, 3, 2, 1,
+	856, 428, 214, 107, 8, 4, 2, 1,
+	858, 429, 286, 143, 78, 66, 39, 33, 26, 22, 13, 11, 6, 3, 2, 1,
+	862, 431, 2, 1,
+	876, 438, 292, 219, 146, 73, 12, 6, 4, 3, 2, 1,
+	880, 440, 220, 176, 110, 88, 80, 55, 44, 40, 22, 20, 16, 11, 10, 8, 5, 4, 2, 1,
+	882, 441, 294, 147, 126, 98, 63, 49, 42, 21, 18, 14, 9, 7, 6, 3, 2, 1,
+	886, 443, 2, 1,
+	906, 453, 302, 151, 6, 3, 2, 1,
+	910, 455, 182, 130, 91, 70, 65, 35, 26, 14, 13, 10, 7, 5, 2, 1,
+	918, 459, 306, 153, 102, 54, 51, 34, 27, 18, 17, 9, 6, 3, 2, 1,
+	928, 464, 232, 116, 58, 32, 29, 16, 8, 4, 2, 1,
+	936, 468, 312, 234, 156, 117, 104, 78, 72, 52, 39, 36, 26, 24, 18, 13, 12, 9, 8, 6, 4, 3, 2, 1,
+	940, 470, 235, 188, 94, 47, 20, 10, 5, 4, 2, 1,
+	946, 473, 86, 43, 22, 11, 2, 1,
+	952, 476, 238, 136, 119, 68, 56, 34, 28, 17, 14, 8, 7, 4, 2, 1,
+	966, 483, 322, 161, 138, 69, 46, 42, 23, 21, 14, 7, 6, 3, 2, 1,
+	970, 485, 194, 97, 10, 5, 2, 1,
+	976, 488, 244, 122, 61, 16, 8, 4, 2, 1,
+	982, 491, 2, 1,
+	990, 495, 330, 198, 165, 110, 99, 90, 66, 55, 45, 33, 30, 22, 18, 15, 11, 10, 9, 6, 5, 3, 2, 1,
+	996, 498, 332, 249, 166, 83, 12, 6, 4, 3, 2, 1,
+	1008, 504, 336, 252, 168, 144, 126, 112, 84, 72, 63, 56, 48, 42, 36, 28, 24, 21, 18, 16, 14, 12, 9, 8, 7, 6, 4, 3, 2, 1,
+	1012, 506, 253, 92, 46, 44, 23, 22, 11, 4, 2, 1,
+	1018, 509, 2, 1,
+	1020, 510, 340, 255, 204, 170, 102, 85, 68, 60, 51, 34, 30, 20, 17, 15, 12, 10, 6, 5, 4, 3, 2, 1,
+	1030, 515, 206, 103, 10, 5, 2, 1,
+	1032, 516, 344, 258, 172, 129, 86, 43, 24, 12, 8, 6, 4, 3, 2, 1,
+	1038, 519, 346, 173, 6, 3, 2, 1,
+	1048, 524, 262, 131, 8, 4, 2, 1,
+	1050, 525, 350, 210, 175, 150, 105, 75, 70, 50, 42, 35, 30, 25, 21, 15, 14, 10, 7, 6, 5, 3, 2, 1,
+	1060, 530, 265, 212, 106, 53, 20, 10, 5, 4, 2, 1,
+	1062, 531, 354, 177, 118, 59, 18, 9, 6, 3, 2, 1,
+	1068, 534, 356, 267, 178, 89, 12, 6, 4, 3, 2, 1,
+	1086, 543, 362, 181, 6, 3, 2, 1,
+	1090, 545, 218, 109, 10, 5, 2, 1,
+	1092, 546, 364, 273, 182, 156, 91, 84, 78, 52, 42, 39, 28, 26, 21, 14, 13, 12, 7, 6, 4, 3, 2, 1,
+	1096, 548, 274, 137, 8, 4, 2, 1,
+	1102, 551, 58, 38, 29, 19, 2, 1,
+	1108, 554, 277, 4, 2, 1,
+	1116, 558, 372, 279, 186, 124, 93, 62, 36, 31, 18, 12, 9, 6, 4, 3, 2, 1,
+	1122, 561, 374, 187, 102, 66, 51, 34, 33, 22, 17, 11, 6, 3, 2, 1,
+	1128, 564, 376, 282, 188, 141, 94, 47, 24, 12, 8, 6, 4, 3, 2, 1,
+	1150, 575, 230, 115, 50, 46, 25, 23, 10, 5, 2, 1,
+	1152, 576, 384, 288, 192, 144, 128, 96, 72, 64, 48, 36, 32, 24, 18, 16, 12, 9, 8, 6, 4, 3, 2, 1,
+	1162, 581, 166, 83, 14, 7, 2, 1,
+	1170, 585, 390, 234, 195, 130, 117, 90, 78, 65, 45, 39, 30, 26, 18, 15, 13, 10, 9, 6, 5, 3, 2, 1,
+	1180, 590, 295, 236, 118, 59, 20, 10, 5, 4, 2, 1,
+	1186, 593, 2, 1,
+	1192, 596, 298, 149, 8, 4, 2, 1,
+	1200, 600, 400, 300, 240, 200, 150, 120, 100, 80, 75, 60, 50, 48, 40, 30, 25, 24, 20, 16, 15, 12, 10, 8, 6, 5, 4, 3, 2, 1,
+	1212, 606, 404, 303, 202, 101, 12, 6, 4, 3, 2, 1,
+	1216, 608, 304, 152, 76, 64, 38, 32, 19, 16, 8, 4, 2, 1,
+	1222, 611, 94, 47, 26, 13, 2, 1,
+	1228, 614, 307, 4, 2, 1,
+	1230, 615, 410, 246, 205, 123, 82, 41, 30, 15, 10, 6, 5, 3, 2, 1,
+	1236, 618, 412, 309, 206, 103, 12, 6, 4, 3, 2, 1,
+	1248, 624, 416, 312, 208, 156, 104, 96, 78, 52, 48, 39, 32, 26, 24, 16, 13, 12, 8, 6, 4, 3, 2, 1,
+	1258, 629, 74, 37, 34, 17, 2, 1,
+	1276, 638, 319, 116, 58, 44, 29, 22, 11, 4, 2, 1,
+	1278, 639, 426, 213, 142, 71, 18, 9, 6, 3, 2, 1,
+	1282, 641, 2, 1,
+	1288, 644, 322, 184, 161, 92, 56, 46, 28, 23, 14, 8, 7, 4, 2, 1,
+	1290, 645, 430, 258, 215, 129, 86, 43, 30, 15, 10, 6, 5, 3, 2, 1,
+	1296, 648, 432, 324, 216, 162, 144, 108, 81, 72, 54, 48, 36, 27, 24, 18, 16, 12, 9, 8, 6, 4, 3, 2, 1,
+	1300, 650, 325, 260, 130, 100, 65, 52, 50, 26, 25, 20, 13, 10, 5, 4, 2, 1,
+	1302, 651, 434, 217, 186, 93, 62, 42, 31, 21, 14, 7, 6, 3, 2, 1,
+	1306, 653, 2, 1,
+	1318, 659, 2, 1,
+	1320, 660, 440, 330, 264, 220, 165, 132, 120, 110, 88, 66, 60, 55, 44, 40, 33, 30, 24, 22, 20, 15, 12, 11, 10, 8, 6, 5, 4, 3, 2, 1,
+	1326, 663, 442, 221, 102, 78, 51, 39, 34, 26, 17, 13, 6, 3, 2, 1,
+	1360, 680, 340, 272, 170, 136, 85, 80, 68, 40, 34, 20, 17, 16, 10, 8, 5, 4, 2, 1,
+	1366, 683, 2, 1,
+	1372, 686, 343, 196, 98, 49, 28, 14, 7, 4, 2, 1,
+	1380, 690, 460, 345, 276, 230, 138, 115, 92, 69, 60, 46, 30, 23, 20, 15, 12, 10, 6, 5, 4, 3, 2, 1,
+	1398, 699, 466, 233, 6, 3, 2, 1,
+	1408, 704, 352, 176, 128, 88, 64, 44, 32, 22, 16, 11, 8, 4, 2, 1,
+	1422, 711, 474, 237, 158, 79, 18, 9, 6, 3, 2, 1,
+	1426, 713, 62, 46, 31, 23, 2, 1,
+	1428, 714, 476, 357, 238, 204, 119, 102, 84, 68, 51, 42, 34, 28, 21, 17, 14, 12, 7, 6, 4, 3, 2, 1,
+	1432, 716, 358, 179, 8, 4, 2, 1,
+	1438, 719, 2, 1,
+	1446, 723, 482, 241, 6, 3, 2, 1,
+	1450, 725, 290, 145, 58, 50, 29, 25, 10, 5, 2, 1,
+	1452, 726, 484, 363, 242, 132, 121, 66, 44, 33, 22, 12, 11, 6, 4, 3, 2, 1,
+	1458, 729, 486, 243, 162, 81, 54, 27, 18, 9, 6, 3, 2, 1,
+	1470, 735, 490, 294, 245, 210, 147, 105, 98, 70, 49, 42, 35, 30, 21, 15, 14, 10, 7, 6, 5, 3, 2, 1,
+	1480, 740, 370, 296, 185, 148, 74, 40, 37, 20, 10, 8, 5, 4, 2, 1,
+	1482, 741, 494, 247, 114, 78, 57, 39, 38, 26, 19, 13, 6, 3, 2, 1,
+	1486, 743, 2, 1,
+	1488, 744, 496, 372, 248, 186, 124, 93, 62, 48, 31, 24, 16, 12, 8, 6, 4, 3, 2, 1,
+	1492, 746, 373, 4, 2, 1,
+	1498, 749, 214, 107, 14, 7, 2, 1,
+	1510, 755, 302, 151, 10, 5, 2, 1,
+	1522, 761, 2, 1,
+	1530, 765, 510, 306, 255, 170, 153, 102, 90, 85, 51, 45, 34, 30, 18, 17, 15, 10, 9, 6, 5, 3, 2, 1,
+	1542, 771, 514, 257, 6, 3, 2, 1,
+	1548, 774, 516, 387, 258, 172, 129, 86, 43, 36, 18, 12, 9, 6, 4, 3, 2, 1,
+	1552, 776, 388, 194, 97, 16, 8, 4, 2, 1,
+	1558, 779, 82, 41, 38, 19, 2, 1,
+	1566, 783, 522, 261, 174, 87, 58, 54, 29, 27, 18, 9, 6, 3, 2, 1,
+	1570, 785, 314, 157, 10, 5, 2, 1,
+	1578, 789, 526, 263, 6, 3, 2, 1,
+	1582, 791, 226, 113, 14, 7, 2, 1,
+	1596, 798, 532, 399, 266, 228, 133, 114, 84, 76, 57, 42, 38, 28, 21, 19, 14, 12, 7, 6, 4, 3, 2, 1,
+	1600, 800, 400, 320, 200, 160, 100, 80, 64, 50, 40, 32, 25, 20, 16, 10, 8, 5, 4, 2, 1,
+	1606, 803, 146, 73, 22, 11, 2, 1,
+	1608, 804, 536, 402, 268, 201, 134, 67, 24, 12, 8, 6, 4, 3, 2, 1,
+	1612, 806, 403, 124, 62, 52, 31, 26, 13, 4, 2, 1,
+	1618, 809, 2, 1,
+	1620, 810, 540, 405, 324, 270, 180, 162, 135, 108, 90, 81, 60, 54, 45, 36, 30, 27, 20, 18, 15, 12, 10, 9, 6, 5, 4, 3, 2, 1,
+	1626, 813, 542, 271, 6, 3, 2, 1,
+	1636, 818, 409, 4, 2, 1,
+	1656, 828, 552, 414, 276, 207, 184, 138, 92, 72, 69, 46, 36, 24, 23, 18, 12, 9, 8, 6, 4, 3, 2, 1,
+	1662, 831, 554, 277, 6, 3, 2, 1,
+	1666, 833, 238, 119, 98, 49, 34, 17, 14, 7, 2, 1,
+	1668, 834, 556, 417, 278, 139, 12, 6, 4, 3, 2, 1,
+	1692, 846, 564, 423, 282, 188, 141, 94, 47, 36, 18, 12, 9, 6, 4, 3, 2, 1,
+	1696, 848, 424, 212, 106, 53, 32, 16, 8, 4, 2, 1,
+	1698, 849, 566, 283, 6, 3, 2, 1,
+	1708, 854, 427, 244, 122, 61, 28, 14, 7, 4, 2, 1,
+	1720, 860, 430, 344, 215, 172, 86, 43, 40, 20, 10, 8, 5, 4, 2, 1,
+	1722, 861, 574, 287, 246, 123, 82, 42, 41, 21, 14, 7, 6, 3, 2, 1,
+	1732, 866, 433, 4, 2, 1,
+	1740, 870, 580, 435, 348, 290, 174, 145, 116, 87, 60, 58, 30, 29, 20, 15, 12, 10, 6, 5, 4, 3, 2, 1,
+	1746, 873, 582, 291, 194, 97, 18, 9, 6, 3, 2, 1,
+	1752, 876, 584, 438, 292, 219, 146, 73, 24, 12, 8, 6, 4, 3, 2, 1,
+	1758, 879, 586, 293, 6, 3, 2, 1,
+	1776, 888, 592, 444, 296, 222, 148, 111, 74, 48, 37, 24, 16, 12, 8, 6, 4, 3, 2, 1,
+	1782, 891, 594, 297, 198, 162, 99, 81, 66, 54, 33, 27, 22, 18, 11, 9, 6, 3, 2, 1,
+	1786, 893, 94, 47, 38, 19, 2, 1,
+	1788, 894, 596, 447, 298, 149, 12, 6, 4, 3, 2, 1,
+	1800, 900, 600, 450, 360, 300, 225, 200, 180, 150, 120, 100, 90, 75, 72, 60, 50, 45, 40, 36, 30, 25, 24, 20, 18, 15, 12, 10, 9, 8, 6, 5, 4, 3, 2, 1,
+	1810, 905, 362, 181, 10, 5, 2, 1,
+	1822, 911, 2, 1,
+	1830, 915, 610, 366, 305, 183, 122, 61, 30, 15, 10, 6, 5, 3, 2, 1,
+	1846, 923, 142, 71, 26, 13, 2, 1,
+	1860, 930, 620, 465, 372, 310, 186, 155, 124, 93, 62, 60, 31, 30, 20, 15, 12, 10, 6, 5, 4, 3, 2, 1,
+	1866, 933, 622, 311, 6, 3, 2, 1,
+	1870, 935, 374, 187, 170, 110, 85, 55, 34, 22, 17, 11, 10, 5, 2, 1,
+	1872, 936, 624, 468, 312, 234, 208, 156, 144, 117, 104, 78, 72, 52, 48, 39, 36, 26, 24, 18, 16, 13, 12, 9, 8, 6, 4, 3, 2, 1,
+	1876, 938, 469, 268, 134, 67, 28, 14, 7, 4, 2, 1,
+	1878, 939, 626, 313, 6, 3, 2, 1,
+	1888, 944, 472, 236, 118, 59, 32, 16, 8, 4, 2, 1,
+	1900, 950, 475, 380, 190, 100, 95, 76, 50, 38, 25, 20, 19, 10, 5, 4, 2, 1,
+	1906, 953, 2, 1,
+	1912, 956, 478, 239, 8, 4, 2, 1,
+	1930, 965, 386, 193, 10, 5, 2, 1,
+	1932, 966, 644, 483, 322, 276, 161, 138, 92, 84, 69, 46, 42, 28, 23, 21, 14, 12, 7, 6, 4, 3, 2, 1,
+	1948, 974, 487, 4, 2, 1,
+	1950, 975, 650, 390, 325, 195, 150, 130, 78, 75, 65, 50, 39, 30, 26, 25, 15, 13, 10, 6, 5, 3, 2, 1,
+	1972, 986, 493, 116, 68, 58, 34, 29, 17, 4, 2, 1,
+	1978, 989, 86, 46, 43, 23, 2, 1,
+	1986, 993, 662, 331, 6, 3, 2, 1,
+	1992, 996, 664, 498, 332, 249, 166, 83, 24, 12, 8, 6, 4, 3, 2, 1,
+	1996, 998, 499, 4, 2, 1,
+	1998, 999, 666, 333, 222, 111, 74, 54, 37, 27, 18, 9, 6, 3, 2, 1,
+	2002, 1001, 286, 182, 154, 143, 91, 77, 26, 22, 14, 13, 11, 7, 2, 1,
+	2010, 1005, 670, 402, 335, 201, 134, 67, 30, 15, 10, 6, 5, 3, 2, 1,
+	2016, 1008, 672, 504, 336, 288, 252, 224, 168, 144, 126, 112, 96, 84, 72, 63, 56, 48, 42, 36, 32, 28, 24, 21, 18, 16, 14, 12, 9, 8, 7, 6, 4, 3, 2, 1,
+	2026, 1013, 2, 1,
+	2028, 1014, 676, 507, 338, 169, 156, 78, 52, 39, 26, 13, 12, 6, 4, 3, 2, 1,
+	2038, 1019, 2, 1,
+	2052, 1026, 684, 513, 342, 228, 171, 114, 108, 76, 57, 54, 38, 36, 27, 19, 18, 12, 9, 6, 4, 3, 2, 1,
+	2062, 1031, 2, 1,
+	2068, 1034, 517, 188, 94, 47, 44, 22, 11, 4, 2, 1,
+	2080, 1040, 520, 416, 260, 208, 160, 130, 104, 80, 65, 52, 40, 32, 26, 20, 16, 13, 10, 8, 5, 4, 2, 1,
+	2082, 1041, 694, 347, 6, 3, 2, 1,
+	2086, 1043, 298, 149, 14, 7, 2, 1,
+	2088, 1044, 696, 522, 348, 261, 232, 174, 116, 87, 72, 58, 36, 29, 24, 18, 12, 9, 8, 6, 4, 3, 2, 1,
+	2098, 1049, 2, 1,
+	2110, 1055, 422, 211, 10, 5, 2, 1,
+	2112, 1056, 704, 528, 352, 264, 192, 176, 132, 96, 88, 66, 64, 48, 44, 33, 32, 24, 22, 16, 12, 11, 8, 6, 4, 3, 2, 1,
+	2128, 1064, 532, 304, 266, 152, 133, 112, 76, 56, 38, 28, 19, 16, 14, 8, 7, 4, 2, 1,
+	2130, 1065, 710, 426, 355, 213, 142, 71, 30, 15, 10, 6, 5, 3, 2, 1,
+	2136, 1068, 712, 534, 356, 267, 178, 89, 24, 12, 8, 6, 4, 3, 2, 1,
+	2140, 1070, 535, 428, 214, 107, 20, 10, 5, 4, 2, 1,
+	2142, 1071, 714, 357, 306, 238, 153, 126, 119, 102, 63, 51, 42, 34, 21, 18, 17, 14, 9, 7, 6, 3, 2, 1,
+	2152, 1076, 538, 269, 8, 4, 2, 1,
+	2160, 1080, 720, 540, 432, 360, 270, 240, 216, 180, 144, 135, 120, 108, 90, 80, 72, 60, 54, 48, 45, 40, 36, 30, 27, 24, 20, 18, 16, 15, 12, 10, 9, 8, 6, 5, 4, 3, 2, 1,
+	2178, 1089, 726, 363, 242, 198, 121, 99, 66, 33, 22, 18, 11, 9, 6, 3, 2, 1,
+	2202, 1101, 734, 367, 6, 3, 2, 1,
+	2206, 1103, 2, 1,
+	2212, 1106, 553, 316, 158, 79, 28, 14, 7, 4, 2, 1,
+	2220, 1110, 740, 555, 444, 370, 222, 185, 148, 111, 74, 60, 37, 30, 20, 15, 12, 10, 6, 5, 4, 3, 2, 1,
+	2236, 1118, 559, 172, 86, 52, 43, 26, 13, 4, 2, 1,
+	2238, 1119, 746, 373, 6, 3, 2, 1,
+	2242, 1121, 118, 59, 38, 19, 2, 1,
+	2250, 1125, 750, 450, 375, 250, 225, 150, 125, 90, 75, 50, 45, 30, 25, 18, 15, 10, 9, 6, 5, 3, 2, 1,
+	2266, 1133, 206, 103, 22, 11, 2, 1,
+	2268, 1134, 756, 567, 378, 324, 252, 189, 162, 126, 108, 84, 81, 63, 54, 42, 36, 28, 27, 21, 18, 14, 12, 9, 7, 6, 4, 3, 2, 1,
+	2272, 1136, 568, 284, 142, 71, 32, 16, 8, 4, 2, 1,
+	2280, 1140, 760, 570, 456, 380, 285, 228, 190, 152, 120, 114, 95, 76, 60, 57, 40, 38, 30, 24, 20, 19, 15, 12, 10, 8, 6, 5, 4, 3, 2, 1,
+	2286, 1143, 762, 381, 254, 127, 18, 9, 6, 3, 2, 1,
+	2292, 1146, 764, 573, 382, 191, 12, 6, 4, 3, 2, 1,
+	2296, 1148, 574, 328, 287, 164, 82, 56, 41, 28, 14, 8, 7, 4, 2, 1,
+	2308, 1154, 577, 4, 2, 1,
+	2310, 1155, 770, 462, 385, 330, 231, 210, 165, 154, 110, 105, 77, 70, 66, 55, 42, 35, 33, 30, 22, 21, 15, 14, 11, 10, 7, 6, 5, 3, 2, 1,
+	2332, 1166, 583, 212, 106, 53, 44, 22, 11, 4, 2, 1,
+	2338, 1169, 334, 167, 14, 7, 2, 1,
+	2340, 1170, 780, 585, 468, 390, 260, 234, 195, 180, 156, 130, 117, 90, 78, 65, 60, 52, 45, 39, 36, 30, 26, 20, 18, 15, 13, 12, 10, 9, 6, 5, 4, 3, 2, 1,
+	2346, 1173, 782, 391, 138, 102, 69, 51, 46, 34, 23, 17, 6, 3, 2, 1,
+	2350, 1175, 470, 235, 94, 50, 47, 25, 10, 5, 2, 1,
+	2356, 1178, 589, 124, 76, 62, 38, 31, 19, 4, 2, 1,
+	2370, 1185, 790, 474, 395, 237, 158, 79, 30, 15, 10, 6, 5, 3, 2, 1,
+	2376, 1188, 792, 594, 396, 297, 264, 216, 198, 132, 108, 99, 88, 72, 66, 54, 44, 36, 33, 27, 24, 22, 18, 12, 11, 9, 8, 6, 4, 3, 2, 1,
+	2380, 1190, 595, 476, 340, 238, 170, 140, 119, 85, 70, 68, 35, 34, 28, 20, 17, 14, 10, 7, 5, 4, 2, 1,
+	2382, 1191, 794, 397, 6, 3, 2, 1,
+	2388, 1194, 796, 597, 398, 199, 12, 6, 4, 3, 2, 1,
+	2392, 1196, 598, 299, 184, 104, 92, 52, 46, 26, 23, 13, 8, 4, 2, 1,
+	2398, 1199, 218, 109, 22, 11, 2, 1,
+	2410, 1205, 482, 241, 10, 5, 2, 1,
+	2416, 1208, 604, 302, 151, 16, 8, 4, 2, 1,
+	2422, 1211, 346, 173, 14, 7, 2, 1,
+	2436, 1218, 812, 609, 406, 348, 203, 174, 116, 87, 84, 58, 42, 29, 28, 21, 14, 12, 7, 6, 4, 3, 2, 1,
+	2440, 1220, 610, 488, 305, 244, 122, 61, 40, 20, 10, 8, 5, 4, 2, 1,
+	2446, 1223, 2, 1,
+	2458, 1229, 2, 1,
+	2466, 1233, 822, 411, 274, 137, 18, 9, 6, 3, 2, 1,
+	2472, 1236, 824, 618, 412, 309, 206, 103, 24, 12, 8, 6, 4, 3, 2, 1,
+	2476, 1238, 619, 4, 2, 1,
+	2502, 1251, 834, 417, 278, 139, 18, 9, 6, 3, 2, 1,
+	2520, 1260, 840, 630, 504, 420, 360, 315, 280, 252, 210, 180, 168, 140, 126, 120, 105, 90, 84, 72, 70, 63, 60, 56, 45, 42, 40, 36, 35, 30, 28, 24, 21, 20, 18, 15, 14, 12, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+	2530, 1265, 506, 253, 230, 115, 110, 55, 46, 23, 22, 11, 10, 5, 2, 1,
+	2538, 1269, 846, 423, 282, 141, 94, 54, 47, 27, 18, 9, 6, 3, 2, 1,
+	2542, 1271, 82, 62, 41, 31, 2, 1,
+	2548, 1274, 637, 364, 196, 182, 98, 91, 52, 49, 28, 26, 14, 13, 7, 4, 2, 1,
+	2550, 1275, 850, 510, 425, 255, 170, 150, 102, 85, 75, 51, 50, 34, 30, 25, 17, 15, 10, 6, 5, 3, 2, 1,
+	2556, 1278, 852, 639, 426, 284, 213, 142, 71, 36, 18, 12, 9, 6, 4, 3, 2, 1,
+	2578, 1289, 2, 1,
+	2590, 1295, 518, 370, 259, 185, 74, 70, 37, 35, 14, 10, 7, 5, 2, 1,
+	2592, 1296, 864, 648, 432, 324, 288, 216, 162, 144, 108, 96, 81, 72, 54, 48, 36, 32, 27, 24, 18, 16, 12, 9, 8, 6, 4, 3, 2, 1,
+	2608, 1304, 652, 326, 163, 16, 8, 4, 2, 1,
+	2616, 1308, 872, 654, 436, 327, 218, 109, 24, 12, 8, 6, 4, 3, 2, 1,
+	2620, 1310, 655, 524, 262, 131, 20, 10, 5, 4, 2, 1,
+	2632, 1316, 658, 376, 329, 188, 94, 56, 47, 28, 14, 8, 7, 4, 2, 1,
+	2646, 1323, 882, 441, 378, 294, 189, 147, 126, 98, 63, 54, 49, 42, 27, 21, 18, 14, 9, 7, 6, 3, 2, 1,
+	2656, 1328, 664, 332, 166, 83, 32, 16, 8, 4, 2, 1,
+	2658, 1329, 886, 443, 6, 3, 2, 1,
+	2662, 1331, 242, 121, 22, 11, 2, 1,
+	2670, 1335, 890, 534, 445, 267, 178, 89, 30, 15, 10, 6, 5, 3, 2, 1,
+	2676, 1338, 892, 669, 446, 223, 12, 6, 4, 3, 2, 1,
+	2682, 1341, 894, 447, 298, 149, 18, 9, 6, 3, 2, 1,
+	2686, 1343, 158, 79, 34, 17, 2, 1,
+	2688, 1344, 896, 672, 448, 384, 336, 224, 192, 168, 128, 112, 96, 84, 64, 56, 48, 42, 32, 28, 24, 21, 16, 14, 12, 8, 7, 6, 4, 3, 2, 1,
+	2692, 1346, 673, 4, 2, 1,
+	2698, 1349, 142, 71, 38, 19, 2, 1,
+	2706, 1353, 902, 451, 246, 123, 82, 66, 41, 33, 22, 11, 6, 3, 2, 1,
+	2710, 1355, 542, 271, 10, 5, 2, 1,
+	2712, 1356, 904, 678, 452, 339, 226, 113, 24, 12, 8, 6, 4, 3, 2, 1,
+	2718, 1359, 906, 453, 302, 151, 18, 9, 6, 3, 2, 1,
+	2728, 1364, 682, 341, 248, 124, 88, 62, 44, 31, 22, 11, 8, 4, 2, 1,
+	2730, 1365, 910, 546, 455, 390, 273, 210, 195, 182, 130, 105, 91, 78, 70, 65, 42, 39, 35, 30, 26, 21, 15, 14, 13, 10, 7, 6, 5, 3, 2, 1,
+	2740, 1370, 685, 548, 274, 137, 20, 10, 5, 4, 2, 1,
+	2748, 1374, 916, 687, 458, 229, 12, 6, 4, 3, 2, 1,
+	2752, 1376, 688, 344, 172, 86, 64, 43, 32, 16, 8, 4, 2, 1,
+	2766, 1383, 922, 461, 6, 3, 2, 1,
+	2776, 1388, 694, 347, 8, 4, 2, 1,
+	2788, 1394, 697, 164, 82, 68, 41, 34, 17, 4, 2, 1,
+	2790, 1395, 930, 558, 465, 310, 279, 186, 155, 93, 90, 62, 45, 31, 30, 18, 15, 10, 9, 6, 5, 3, 2, 1,
+	2796, 1398, 932, 699, 466, 233, 12, 6, 4, 3, 2, 1,
+	2800, 1400, 700, 560, 400, 350, 280, 200, 175, 140, 112, 100, 80, 70, 56, 50, 40, 35, 28, 25, 20, 16, 14, 10, 8, 7, 5, 4, 2, 1,
+	2802, 1401, 934, 467, 6, 3, 2, 1,
+	2818, 1409, 2, 1,
+	2832, 1416, 944, 708, 472, 354, 236, 177, 118, 59, 48, 24, 16, 12, 8, 6, 4, 3, 2, 1,
+	2836, 1418, 709, 4, 2, 1,
+	2842, 1421, 406, 203, 98, 58, 49, 29, 14, 7, 2, 1,
+	2850, 1425, 950, 570, 475, 285, 190, 150, 114, 95, 75, 57, 50, 38, 30, 25, 19, 15, 10, 6, 5, 3, 2, 1,
+	2856, 1428, 952, 714, 476, 408, 357, 238, 204, 168, 136, 119, 102, 84, 68, 56, 51, 42, 34, 28, 24, 21, 17, 14, 12, 8, 7, 6, 4, 3, 2, 1,
+	2860, 1430, 715, 572, 286, 260, 220, 143, 130, 110, 65, 55, 52, 44, 26, 22, 20, 13, 11, 10, 5, 4, 2, 1,
+	2878, 1439, 2, 1,
+	2886, 1443, 962, 481, 222, 111, 78, 74, 39, 37, 26, 13, 6, 3, 2, 1,
+	2896, 1448, 724, 362, 181, 16, 8, 4, 2, 1,
+	2902, 1451, 2, 1,
+	2908, 1454, 727, 4, 2, 1,
+	2916, 1458, 972, 729, 486, 324, 243, 162, 108, 81, 54, 36, 27, 18, 12, 9, 6, 4, 3, 2, 1,
+	2926, 1463, 418, 266, 209, 154, 133, 77, 38, 22, 19, 14, 11, 7, 2, 1,
+	2938, 1469, 226, 113, 26, 13, 2, 1,
+	2952, 1476, 984, 738, 492, 369, 328, 246, 164, 123, 82, 72, 41, 36, 24, 18, 12, 9, 8, 6, 4, 3, 2, 1,
+	2956, 1478, 739, 4, 2, 1,
+	2962, 1481, 2, 1,
+	2968, 1484, 742, 424, 371, 212, 106, 56, 53, 28, 14, 8, 7, 4, 2, 1,
+	2970, 1485, 990, 594, 495, 330, 297, 270, 198, 165, 135, 110, 99, 90, 66, 55, 54, 45, 33, 30, 27, 22, 18, 15, 11, 10, 9, 6, 5, 3, 2, 1,
+	2998, 1499, 2, 1,
+	3000, 1500, 1000, 750, 600, 500, 375, 300, 250, 200, 150, 125, 120, 100, 75, 60, 50, 40, 30, 25, 24, 20, 15, 12, 10, 8, 6, 5, 4, 3, 2, 1,
+	3010, 1505, 602, 430, 301, 215, 86, 70, 43, 35, 14, 10, 7, 5, 2, 1,
+	3018, 1509, 1006, 503, 6, 3, 2, 1,
+	3022, 1511, 2, 1,
+	3036, 1518, 1012, 759, 506, 276, 253, 138, 132, 92, 69, 66, 46, 44, 33, 23, 22, 12, 11, 6, 4, 3, 2, 1,
+	3040, 1520, 760, 608, 380, 304, 190, 160, 152, 95, 80, 76, 40, 38, 32, 20, 19, 16, 10, 8, 5, 4, 2, 1,
+	3048, 1524, 1016, 762, 508, 381, 254, 127, 24, 12, 8, 6, 4, 3, 2, 1,
+	3060, 1530, 1020, 765, 612, 510, 340, 306, 255, 204, 180, 170, 153, 102, 90, 85, 68, 60, 51, 45, 36, 34, 30, 20, 18, 17, 15, 12, 10, 9, 6, 5, 4, 3, 2, 1,
+	3066, 1533, 1022, 511, 438, 219, 146, 73, 42, 21, 14, 7, 6, 3, 2, 1,
+	3078, 1539, 1026, 513, 342, 171, 162, 114, 81, 57, 54, 38, 27, 19, 18, 9, 6, 3, 2, 1,
+	3082, 1541, 134, 67, 46, 23, 2, 1,
+	3088, 1544, 772, 386, 193, 16, 8, 4, 2, 1,
+	3108, 1554, 1036, 777, 518, 444, 259, 222, 148, 111, 84, 74, 42, 37, 28, 21, 14, 12, 7, 6, 4, 3, 2, 1,
+	3118, 1559, 2, 1,
+	3120, 1560, 1040, 780, 624, 520, 390, 312, 260, 240, 208, 195, 156, 130, 120, 104, 80, 78, 65, 60, 52, 48, 40, 39, 30, 26, 24, 20, 16, 15, 13, 12, 10, 8, 6, 5, 4, 3, 2, 1,
+	3136, 1568, 784, 448, 392, 224, 196, 112, 98, 64, 56, 49, 32, 28, 16, 14, 8, 7, 4, 2, 1,
+	3162, 1581, 1054, 527, 186, 102, 93, 62, 51, 34, 31, 17, 6, 3, 2, 1,
+	3166, 1583, 2, 1,
+	3168, 1584, 1056, 792, 528, 396, 352, 288, 264, 198, 176, 144, 132, 99, 96, 88, 72, 66, 48, 44, 36, 33, 32, 24, 22, 18, 16, 12, 11, 9, 8, 6, 4, 3, 2, 1,
+	3180, 1590, 1060, 795, 636, 530, 318, 265, 212, 159, 106, 60, 53, 30, 20, 15, 12, 10, 6, 5, 4, 3, 2, 1,
+	3186, 1593, 1062, 531, 354, 177, 118, 59, 54, 27, 18, 9, 6, 3, 2, 1,
+	3190, 1595, 638, 319, 290, 145, 110, 58, 55, 29, 22, 11, 10, 5, 2, 1,
+	3202, 1601, 2, 1,
+	3208, 1604, 802, 401, 8, 4, 2, 1,
+	3216, 1608, 1072, 804, 536, 402, 268, 201, 134, 67, 48, 24, 16, 12, 8, 6, 4, 3, 2, 1,
+	3220, 1610, 805, 644, 460, 322, 230, 161, 140, 115, 92, 70, 46, 35, 28, 23, 20, 14, 10, 7, 5, 4, 2, 1,
+	3228, 1614, 1076, 807, 538, 269, 12, 6, 4, 3, 2, 1,
+	3250, 1625, 650, 325, 250, 130, 125, 65, 50, 26, 25, 13, 10, 5, 2, 1,
+	3252, 1626, 1084, 813, 542, 271, 12, 6, 4, 3, 2, 1,
+	3256, 1628, 814, 407, 296, 148, 88, 74, 44, 37, 22, 11, 8, 4, 2, 1,
+	3258, 1629, 1086, 543, 362, 181, 18, 9, 6, 3, 2, 1,
+	3270, 1635, 1090, 654, 545, 327, 218, 109, 30, 15, 10, 6, 5, 3, 2, 1,
+	3298, 1649, 194, 97, 34, 17, 2, 1,
+	3300, 1650, 1100, 825, 660, 550, 330, 300, 275, 220, 165, 150, 132, 110, 100, 75, 66, 60, 55, 50, 44, 33, 30, 25, 22, 20, 15, 12, 11, 10, 6, 5, 4, 3, 2, 1,
+	3306, 1653, 1102, 551, 174, 114, 87, 58, 57, 38, 29, 19, 6, 3, 2, 1,
+	3312, 1656, 1104, 828, 552, 414, 368, 276, 207, 184, 144, 138, 92, 72, 69, 48, 46, 36, 24, 23, 18, 16, 12, 9, 8, 6, 4, 3, 2, 1,
+	3318, 1659, 1106, 553, 474, 237, 158, 79, 42, 21, 14, 7, 6, 3, 2, 1,
+	3322, 1661, 302, 151, 22, 11, 2, 1,
+	3328, 1664, 832, 416, 256, 208, 128, 104, 64, 52, 32, 26, 16, 13, 8, 4, 2, 1,
+	3330, 1665, 1110, 666, 555, 370, 333, 222, 185, 111, 90, 74, 45, 37, 30, 18, 15, 10, 9, 6, 5, 3, 2, 1,
+	3342, 1671, 1114, 557, 6, 3, 2, 1,
+	3346, 1673, 478, 239, 14, 7, 2, 1,
+	3358, 1679, 146, 73, 46, 23, 2, 1,
+	3360, 1680, 1120, 840, 672, 560, 480, 420, 336, 280, 240, 224, 210, 168, 160, 140, 120, 112, 105, 96, 84, 80, 70, 60, 56, 48, 42, 40, 35, 32, 30, 28, 24, 21, 20, 16, 15, 14, 12, 10, 8, 7, 6, 5, 4, 3, 2, 1,
+	3370, 1685, 674, 337, 10, 5, 2, 1,
+	3372, 1686, 1124, 843, 562, 281, 12, 6, 4, 3, 2, 1,
+	3388, 1694, 847, 484, 308, 242, 154, 121, 77, 44, 28, 22, 14, 11, 7, 4, 2, 1,
+	3390, 1695, 1130, 678, 565, 339, 226, 113, 30, 15, 10, 6, 5, 3, 2, 1,
+	3406, 1703, 262, 131, 26, 13, 2, 1,
+	3412, 1706, 853, 4, 2, 1,
+	3432, 1716, 1144, 858, 572, 429, 312, 286, 264, 156, 143, 132, 104, 88, 78, 66, 52, 44, 39, 33, 26, 24, 22, 13, 12, 11, 8, 6, 4, 3, 2, 1,
+	3448, 1724, 862, 431, 8, 4, 2, 1,
+	3456, 1728, 1152, 864, 576, 432, 384, 288, 216, 192, 144, 128, 108, 96, 72, 64, 54, 48, 36, 32, 27, 24, 18, 16, 12, 9, 8, 6, 4, 3, 2, 1,
+	3460, 1730, 865, 692, 346, 173, 20, 10, 5, 4, 2, 1,
+	3462, 1731, 1154, 577, 6, 3, 2, 1,
+	3466, 1733, 2, 1,
+	3468, 1734, 1156, 867, 578, 289, 204, 102, 68, 51, 34, 17, 12, 6, 4, 3, 2, 1,
+	3490, 1745, 698, 349, 10, 5, 2, 1,
+	3498, 1749, 1166, 583, 318, 159, 106, 66, 53, 33, 22, 11, 6, 3, 2, 1,
+	3510, 1755, 1170, 702, 585, 390, 351, 270, 234, 195, 135, 130, 117, 90, 78, 65, 54, 45, 39, 30, 27, 26, 18, 15, 13, 10, 9, 6, 5, 3, 2, 1,
+	3516, 1758, 1172, 879, 586, 293, 12, 6, 4, 3, 2, 1,
+	3526, 1763, 86, 82, 43, 41, 2, 1,
+	3528, 1764, 1176, 882, 588, 504, 441, 392, 294, 252, 196, 168, 147, 126, 98, 84, 72, 63, 56, 49, 42, 36, 28, 24, 21, 18, 14, 12, 9, 8, 7, 6, 4, 3, 2, 1,
+	3532, 1766, 883, 4, 2, 1,
+	3538, 1769, 122, 61, 58, 29, 2, 1,
+	3540, 1770, 1180, 885, 708, 590, 354, 295, 236, 177, 118, 60, 59, 30, 20, 15, 12, 10, 6, 5, 4, 3, 2, 1,
+	3546, 1773, 1182, 591, 394, 197, 18, 9, 6, 3, 2, 1,
+	3556, 1778, 889, 508, 254, 127, 28, 14, 7, 4, 2, 1,
+	3558, 1779, 1186, 593, 6, 3, 2, 1,
+	3570, 1785, 1190, 714, 595, 510, 357, 255, 238, 210, 170, 119, 105, 102, 85, 70, 51, 42, 35, 34, 30, 21, 17, 15, 14, 10, 7, 6, 5, 3, 2, 1,
+	3580, 1790, 895, 716, 358, 179, 20, 10, 5, 4, 2, 1,
+	3582, 1791, 1194, 597, 398, 199, 18, 9, 6, 3, 2, 1,
+	3592, 1796, 898, 449, 8, 4, 2, 1,
+	3606, 1803, 1202, 601, 6, 3, 2, 1,
+	3612, 1806, 1204, 903, 602, 516, 301, 258, 172, 129, 86, 84, 43, 42, 28, 21, 14, 12, 7, 6, 4, 3, 2, 1,
+	3616, 1808, 904, 452, 226, 113, 32, 16, 8, 4, 2, 1,
+	3622, 1811, 2, 1,
+	3630, 1815, 1210, 726, 605, 363, 330, 242, 165, 121, 110, 66, 55, 33, 30, 22, 15, 11, 10, 6, 5, 3, 2, 1,
+	3636, 1818, 1212, 909, 606, 404, 303, 202, 101, 36, 18, 12, 9, 6, 4, 3, 2, 1,
+	3642, 1821, 1214, 607, 6, 3, 2, 1,
+	3658, 1829, 118, 62, 59, 31, 2, 1,
+	3670, 1835, 734, 367, 10, 5, 2, 1,
+	3672, 1836, 1224, 918, 612, 459, 408, 306, 216, 204, 153, 136, 108, 102, 72, 68, 54, 51, 36, 34, 27, 24, 18, 17, 12, 9, 8, 6, 4, 3, 2, 1,
+	3676, 1838, 919, 4, 2, 1,
+	3690, 1845, 1230, 738, 615, 410, 369, 246, 205, 123, 90, 82, 45, 41, 30, 18, 15, 10, 9, 6, 5, 3, 2, 1,
+	3696, 1848, 1232, 924, 616, 528, 462, 336, 308, 264, 231, 176, 168, 154, 132, 112, 88, 84, 77, 66, 56, 48, 44, 42, 33, 28, 24, 22, 21, 16, 14, 12, 11, 8, 7, 6, 4, 3, 2, 1,
+	3700, 1850, 925, 740, 370, 185, 148, 100, 74, 50, 37, 25, 20, 10, 5, 4, 2, 1,
+	3708, 1854, 1236, 927, 618, 412, 309, 206, 103, 36, 18, 12, 9, 6, 4, 3, 2, 1,
+	3718, 1859, 338, 286, 169, 143, 26, 22, 13, 11, 2, 1,
+	3726, 1863, 1242, 621, 414, 207, 162, 138, 81, 69, 54, 46, 27, 23, 18, 9, 6, 3, 2, 1,
+	3732, 1866, 1244, 933, 622, 311, 12, 6, 4, 3, 2, 1,
+	3738, 1869, 1246, 623, 534, 267, 178, 89, 42, 21, 14, 7, 6, 3, 2, 1,
+	3760, 1880, 940, 752, 470, 376, 235, 188, 94, 80, 47, 40, 20, 16, 10, 8, 5, 4, 2, 1,
+	3766, 1883, 538, 269, 14, 7, 2, 1,
+	3768, 1884, 1256, 942, 628, 471, 314, 157, 24, 12, 8, 6, 4, 3, 2, 1,
+	3778, 1889, 2, 1,
+	3792, 1896, 1264, 948, 632, 474, 316, 237, 158, 79, 48, 24, 16, 12, 8, 6, 4, 3, 2, 1,
+	3796, 1898, 949, 292, 146, 73, 52, 26, 13, 4, 2, 1,
+	3802, 1901, 2, 1,
+	3820, 1910, 955, 764, 382, 191, 20, 10, 5, 4, 2, 1,
+	3822, 1911, 1274, 637, 546, 294, 273, 182, 147, 98, 91, 78, 49, 42, 39, 26, 21, 14, 13, 7, 6, 3, 2, 1,
+	3832, 1916, 958, 479, 8, 4, 2, 1,
+	3846, 1923, 1282, 641, 6, 3, 2, 1,
+	3850, 1925, 770, 550, 385, 350, 275, 175, 154, 110, 77, 70, 55, 50, 35, 25, 22, 14, 11, 10, 7, 5, 2, 1,
+	3852, 1926, 1284, 963, 642, 428, 321, 214, 107, 36, 18, 12, 9, 6, 4, 3, 2, 1,
+	3862, 1931, 2, 1,
+	3876, 1938, 1292, 969, 646, 323, 228, 204, 114, 102, 76, 68, 57, 51, 38, 34, 19, 17, 12, 6, 4, 3, 2, 1,
+	3880, 1940, 970, 776, 485, 388, 194, 97, 40, 20, 10, 8, 5, 4, 2, 1,
+	3888, 1944, 1296, 972, 648, 486, 432, 324, 243, 216, 162, 144, 108, 81, 72, 54, 48, 36, 27, 24, 18, 16, 12, 9, 8, 6, 4, 3, 2, 1,
+	3906, 1953, 1302, 651, 558, 434, 279, 217, 186, 126, 93, 63, 62, 42, 31, 21, 18, 14, 9, 7, 6, 3, 2, 1,
+	3910, 1955, 782, 391, 230, 170, 115, 85, 46, 34, 23, 17, 10, 5, 2, 1,
+	3916, 1958, 979, 356, 178, 89, 44, 22, 11, 4, 2, 1,
+	3918, 1959, 1306, 653, 6, 3, 2, 1,
+	3922, 1961, 106, 74, 53, 37, 2, 1,
+	3928, 1964, 982, 491, 8, 4, 2, 1,
+	3930, 1965, 1310, 786, 655, 393, 262, 131, 30, 15, 10, 6, 5, 3, 2, 1,
+	3942, 1971, 1314, 657, 438, 219, 146, 73, 54, 27, 18, 9, 6, 3, 2, 1,
+	3946, 1973, 2, 1,
+	3966, 1983, 1322, 661, 6, 3, 2, 1,
+	3988, 1994, 997, 4, 2, 1,
+	4000, 2000, 1000, 800, 500, 400, 250, 200, 160, 125, 100, 80, 50, 40, 32, 25, 20, 16, 10, 8, 5, 4, 2, 1,
+	4002, 2001, 1334, 667, 174, 138, 87, 69, 58, 46, 29, 23, 6, 3, 2, 1,
+	4006, 2003, 2, 1,
+	4012, 2006, 1003, 236, 118, 68, 59, 34, 17, 4, 2, 1,
+	4018, 2009, 574, 287, 98, 82, 49, 41, 14, 7, 2, 1,
+	4020, 2010, 1340, 1005, 804, 670, 402, 335, 268, 201, 134, 67, 60, 30, 20, 15, 12, 10, 6, 5, 4, 3, 2, 1,
+	4026, 2013, 1342, 671, 366, 183, 122, 66, 61, 33, 22, 11, 6, 3, 2, 1,
+	4048, 2024, 1012, 506, 368, 253, 184, 176, 92, 88, 46, 44, 23, 22, 16, 11, 8, 4, 2, 1,
+	4050, 2025, 1350, 810, 675, 450, 405, 270, 225, 162, 150, 135, 90, 81, 75, 54, 50, 45, 30, 27, 25, 18, 15, 10, 9, 6, 5, 3, 2, 1,
+	4056, 2028, 1352, 1014, 676, 507, 338, 312, 169, 156, 104, 78, 52, 39, 26, 24, 13, 12, 8, 6, 4, 3, 2, 1,
+	4072, 2036, 1018, 509, 8, 4, 2, 1,
+	4078, 2039, 2, 1,
+	4090, 2045, 818, 409, 10, 5, 2, 1,
+	4092, 2046, 1364, 1023, 682, 372, 341, 186, 132, 124, 93, 66, 62, 44, 33, 31, 22, 12, 11, 6, 4, 3, 2, 1
+};
+
+unsigned int phi_divisors_offset[MAXPRIMEINDEX+1] = {
+	0, 2, 5, 9, 13, 19, 24, 30, 34, 40, 48, 57,
+	65, 73, 77, 83, 87, 99, 107, 115, 127, 135, 139, 147,
+	159, 168, 176, 180, 192, 202, 214, 222, 230, 238, 244, 256,
+	268, 278, 282, 288, 292, 310, 318, 332, 341, 353, 369, 377,
+	381, 393, 401, 409, 429, 437, 446, 450, 456, 472, 484, 500,
+	508, 514, 526, 534, 550, 556, 572, 592, 596, 608, 620, 624,
+	632, 644, 660, 664, 670, 688, 703, 719, 727, 751, 759, 779,
+	787, 795, 809, 825, 837, 853, 857, 861, 873, 885, 893, 897,
+	903, 919, 931, 955, 971, 977, 981, 989, 1005, 1026, 1030, 1040,
+	1048, 1072, 1080, 1098, 1114, 1122, 1146, 1162, 1170, 1178, 1184, 1192,
+	1216, 1240, 1249, 1257, 1273, 1291, 1303, 1307, 1319, 1331, 1343, 1351,
+	1367, 1391, 1407, 1425, 1431, 1439, 1445, 1453, 1473, 1485, 1493, 1501,
+	1519, 1523, 1535, 1543, 1559, 1563, 1575, 1595, 1613, 1617, 1625, 1641,
+	1657, 1669, 1693, 1705, 1713, 1729, 1745, 1753, 1763, 1767, 1791, 1803,
+	1833, 1845, 1849, 1873, 1881, 1897, 1905, 1913, 1937, 1949, 1961, 1973,
+	1981, 1989, 2013, 2021, 2029, 2035, 2053, 2069, 2085, 2097, 2121, 2129,
+	2153, 2165, 2169, 2177, 2207, 2219, 2233, 2241, 2247, 2263, 2275, 2299,
+	2307, 2319, 2331, 2335, 2351, 2367, 2392, 2410, 2426, 2430, 2434, 2466,
+	2482, 2502, 2506, 2518, 2542, 2550, 2566, 2578, 2586, 2610, 2618, 2622,
+	2630, 2642, 2660, 2674, 2698, 2714, 2730, 2734, 2754, 2760, 2768, 2776,
+	2780, 2804, 2812, 2830, 2840, 2848, 2864, 2872, 2880, 2888, 2912, 2933,
+	2941, 2957, 2969, 2973, 3003, 3011, 3017, 3041, 3049, 3061, 3073, 3091,
+	3103, 3111, 3123, 3139, 3155, 3161, 3185, 3197, 3213, 3221, 3241, 3261,
+	3269, 3281, 3317, 3325, 3329, 3345, 3353, 3377, 3385, 3401, 3431, 3443,
+	3451, 3463, 3481, 3485, 3493, 3501, 3525, 3531, 3555, 3567, 3575, 3583,
+	3599, 3605, 3621, 3637, 3653, 3689, 3693, 3711, 3715, 3739, 3743, 3755,
+	3779, 3787, 3795, 3819, 3823, 3831, 3859, 3879, 3895, 3911, 3923, 3947,
+	3955, 3995, 4013, 4021, 4025, 4037, 4061, 4073, 4081, 4089, 4113, 4121,
+	4151, 4163, 4195, 4207, 4219, 4235, 4241, 4273, 4285, 4293, 4329, 4345,
+	4357, 4369, 4385, 4417, 4441, 4449, 4461, 4477, 4485, 4493, 4503, 4511,
+	4535, 4551, 4555, 4559, 4571, 4587, 4593, 4605, 4653, 4669, 4685, 4693,
+	4711, 4735, 4753, 4757, 4773, 4803, 4813, 4829, 4841, 4857, 4881, 4893,
+	4901, 4909, 4925, 4937, 4949, 4957, 4989, 4995, 5003, 5019, 5027, 5043,
+	5055, 5071, 5103, 5115, 5127, 5141, 5149, 5157, 5169, 5193, 5205, 5235,
+	5243, 5247, 5267, 5273, 5285, 5309, 5341, 5365, 5369, 5385, 5395, 5399,
+	5405, 5426, 5442, 5450, 5474, 5480, 5484, 5500, 5532, 5536, 5568, 5584,
+	5592, 5596, 5620, 5644, 5660, 5696, 5712, 5732, 5740, 5750, 5774, 5778,
+	5818, 5839, 5855, 5859, 5895, 5919, 5935, 5951, 5955, 5963, 5983, 6007,
+	6019, 6035, 6047, 6063, 6075, 6091, 6099, 6135, 6151, 6181, 6197, 6205,
+	6223, 6247, 6255, 6263, 6271, 6319, 6327, 6339, 6357, 6373, 6381, 6387,
+	6419, 6427, 6459, 6471, 6479, 6483, 6501, 6509, 6525, 6557, 6569, 6577,
+	6613, 6619, 6627, 6651, 6663, 6675, 6683, 6715, 6727, 6739, 6747, 6755,
+	6779, 6791, 6795, 6819, 6837, 6845, 6853, 6861, 6893, 6899, 6923, 6963,
+	6981, 6999, 7011, 7031, 7043, 7059, 7079, 7087, 7103, 7107, 7127, 7139,
+	7143, 7155, 7179, 7187, 7195, 7219, 7237, 7241, 7265, 7281, 7311, 7335,
+	7351, 7363, 7371, 7379, 7387, 7403, 7419, 7423, 7431, 7437, 7461, 7477,
+	7481, 7493, 7505, 7529, 7545, 7565, 7595, 7619, 7627, 7631, 7639, 7663
 };
 
 
@@ -852,6 +906,252 @@ int prime_to_index[MAXPRIME+1] = {
 };
 
 
+/* extension of the above lists beyond MAXPRIME, generated at runtime */
+static unsigned int *ext_primes = NULL;		/* primes[MAXPRIMEINDEX ... MAXTABLEINDEX-1] */
+static int *ext_index = NULL;				/* prime_to_index[0 ... MAXTABLEPRIME] */
+static unsigned int *ext_divisors[MAXTABLEINDEX];
+static unsigned int ext_divisors_count[MAXTABLEINDEX];
+
+/* discriminants[] parsed once */
+static mpz_t discriminants_cache[MAXPRIMEINDEX];
+static unsigned char discriminants_ready[MAXPRIMEINDEX];
+
+/* discriminants[] without the prime factors of disc_factors[] */
+static mpz_t cofactors_cache[MAXPRIMEINDEX];
+static unsigned char cofactors_ready[MAXPRIMEINDEX];
+
+
+/*
+ * table_generate(): sieve the odd primes up to MAXTABLEPRIME, once
+ *
+ * return: 0 on success, -1 otherwise
+ */
+static int table_generate()
+{
+	unsigned int i, j, count = 0;
+	unsigned char *composite;
+
+	if ( ext_index ) { return 0; }
+
+	composite = calloc(MAXTABLEPRIME + 1, 1);
+	ext_primes = malloc((MAXTABLEINDEX - MAXPRIMEINDEX) * sizeof(unsigned int));
+	ext_index = malloc((MAXTABLEPRIME + 1) * sizeof(int));
+
+	if ( !composite || !ext_primes || !ext_index ) {
+		free(composite);
+		free(ext_primes);
+		free(ext_index);
+		ext_primes = NULL;
+		ext_index = NULL;
+		return -1;
+	}
+
+	for (i = 0; i <= MAXTABLEPRIME; i++) {
+		ext_index[i] = -1;
+	}
+
+	for (i = 3; i <= MAXTABLEPRIME; i += 2) {
+
+		if ( composite[i] ) { continue; }
+
+		for (j = i * i; j <= MAXTABLEPRIME; j += 2 * i) {
+			composite[j] = 1;
+		}
+
+		/* ASSERT: the static tables are the head of the sieve */
+		if (count >= MAXPRIMEINDEX) {
+			ext_primes[count - MAXPRIMEINDEX] = i;
+		}
+
+		ext_index[i] = count;
+		count++;
+	}
+
+	free(composite);
+
+	return 0;
+}
+
+
+/*
+ * table_prime(): the odd prime of the given index, 0 if out of the tables
+ */
+unsigned int table_prime(unsigned int index)
+{
+	if (index < MAXPRIMEINDEX) { return primes[index]; }
+
+	if (index >= MAXTABLEINDEX || table_generate()) { return 0; }
+
+	return ext_primes[index - MAXPRIMEINDEX];
+}
+
+
+/*
+ * table_index(): the index of the odd prime l, -1 if l is not a prime of the tables
+ */
+int table_index(unsigned int l)
+{
+	if (l <= MAXPRIME) { return prime_to_index[l]; }
+
+	if (l > MAXTABLEPRIME || table_generate()) { return -1; }
+
+	return ext_index[l];
+}
+
+
+/*
+ * table_divisors(): the divisors of phi(l) = l-1 in decreasing order, for the prime
+ *                   of the given index
+ *
+ * return: the number of divisors, 0 if index is out of the tables
+ */
+unsigned int table_divisors(unsigned int index, const unsigned int **divisors)
+{
+	unsigned int l, phi, d, count = 0;
+
+	if (index < MAXPRIMEINDEX) {
+		*divisors = phi_divisors + phi_divisors_offset[index];
+		return phi_divisors_offset[index+1] - phi_divisors_offset[index];
+	}
+
+	if (index >= MAXTABLEINDEX) { return 0; }
+
+	if ( ext_divisors[index] ) {
+		*divisors = ext_divisors[index];
+		return ext_divisors_count[index];
+	}
+
+	l = table_prime(index);
+	phi = l - 1;
+
+	/* naive trial division, as print_phi_divisors() */
+	for (d = phi; d > 0; d--) {
+		if ( (phi % d) == 0 ) { count++; }
+	}
+
+	ext_divisors[index] = malloc(count * sizeof(unsigned int));
+	if ( !ext_divisors[index] ) { return 0; }
+
+	count = 0;
+	for (d = phi; d > 0; d--) {
+		if ( (phi % d) == 0 ) { ext_divisors[index][count++] = d; }
+	}
+
+	ext_divisors_count[index] = count;
+	*divisors = ext_divisors[index];
+
+	return count;
+}
+
+
+/*
+ * table_discriminant(): the entry of discriminants[] for the prime of the given index,
+ *                       converted from decimal on first use and cached read-only
+ *
+ * return: the cached value, NULL beyond the static tables (see cpseudo_ramifies())
+ */
+mpz_srcptr table_discriminant(unsigned int index)
+{
+	if (index >= MAXPRIMEINDEX) { return NULL; }
+
+	if ( !discriminants_ready[index] ) {
+		mpz_init_set_str(discriminants_cache[index], discriminants[index], 10);
+		discriminants_ready[index] = 1;
+	}
+
+	return discriminants_cache[index];
+}
+
+
+/*
+ * table_cofactor(): what is left of table_discriminant() once the primes of disc_factors[]
+ *                   are removed, computed on first use and cached read-only
+ *
+ * return: the cached value, NULL beyond the static tables
+ */
+mpz_srcptr table_cofactor(unsigned int index)
+{
+	unsigned int i;
+	mpz_t p;
+
+	if (index >= MAXPRIMEINDEX) { return NULL; }
+
+	if ( !cofactors_ready[index] ) {
+
+		mpz_init_set(cofactors_cache[index], table_discriminant(index));
+		mpz_init(p);
+
+		for (i = disc_factors_offset[index]; i < disc_factors_offset[index+1]; i++) {
+			mpz_set_ui(p, disc_factors[i]);
+			mpz_remove(cofactors_cache[index], cofactors_cache[index], p);
+		}
+
+		mpz_clear(p);
+		cofactors_ready[index] = 1;
+	}
+
+	return cofactors_cache[index];
+}
+
+
+/*
+ * table_verify_factors(): check disc_factors[] and disc_cofactors[] against discriminants[]
+ *
+ * every p must be a prime below DISCFACTORBOUND, equal to +-1 mod l and dividing the
+ * discriminant, and a cofactor listed as prime must pass a probable prime test
+ *
+ * return: the number of bad entries
+ */
+unsigned int table_verify_factors(unsigned int verbose)
+{
+	unsigned int i, j, bad = 0;
+
+	for (i = 0; i < MAXPRIMEINDEX; i++) {
+
+		unsigned int l = primes[i];
+		unsigned int ok = 1;
+		mpz_srcptr cofactor = table_cofactor(i);
+
+		for (j = disc_factors_offset[i]; j < disc_factors_offset[i+1]; j++) {
+
+			unsigned int p = disc_factors[j], d;
+
+			for (d = 2; d * d <= p && (p % d) != 0; d++) ;
+
+			if (p >= DISCFACTORBOUND || d * d <= p ||
+					((p % l) != 1 && (p % l) != l - 1) ||
+					mpz_fdiv_ui(table_discriminant(i), p) != 0) {
+				ok = 0;
+			}
+		}
+
+		/* a composite cofactor is only used by a gcd, exact in any case */
+		switch (disc_cofactors[i]) {
+			case DISC_COFACTOR_ONE:
+				if (mpz_cmp_ui(cofactor, 1) != 0) { ok = 0; }
+				break;
+			case DISC_COFACTOR_PRIME:
+				if ( !mpz_probab_prime_p(cofactor, 50) ) { ok = 0; }
+				break;
+		}
+
+		if ( !ok ) {
+			bad++;
+
+			if ( verbose ) {
+				printf("Bad discriminant factors for l = %d.\n", l);
+			}
+		}
+	}
+
+	if ( verbose ) {
+		printf("Discriminant factors of %d primes checked, %d bad.\n", MAXPRIMEINDEX, bad);
+	}
+
+	return bad;
+}
+
+
 /* functions to generate the above lists */
 
 void print_prime_to_index()
@@ -900,9 +1200,10 @@ void print_prime_to_index()
 void print_phi_divisors()
 {
 	unsigned int i, first = 1;
+	unsigned int offset = 0;
 
 	/* for all small primes */
-	printf("struct divisors_list phi_divisors[MAXPRIMEINDEX] = {");
+	printf("unsigned int phi_divisors[MAXPHIDIVISORSTOTAL] = {\n");
 	for (i = 0; i < MAXPRIMEINDEX; i++) {
 
 		unsigned int p = primes[i];
@@ -910,13 +1211,13 @@ void print_phi_divisors()
 		/* p is supposed to be a prime, so phi(p) = p-1 */
 		unsigned int phi = p - 1;
 
-		unsigned int d, count = 0;
+		unsigned int d;
 		unsigned int innerfirst = 1;
 
 		if ( ! first ) { printf(",\n"); }
 		first = 0;
 
-		printf("\t{ {");
+		printf("\t");
 
 		/* naive trial division */
 		for (d = phi; d > 0; d--) {
@@ -928,13 +1229,30 @@ void print_phi_divisors()
 				innerfirst = 0;
 
 				printf("%d", d);
-
-				count++;
 			}
 		}
+	}
+
+	printf("\n};\n\n");
 
-		printf("}, %d }", count);
+	/* offsets of each list, the last one is MAXPHIDIVISORSTOTAL */
+	printf("unsigned int phi_divisors_offset[MAXPRIMEINDEX+1] = {\n");
+	for (i = 0; i <= MAXPRIMEINDEX; i++) {
 
+		if ( i > 0 ) { printf( (i % 12) ? ", " : ",\n"); }
+		if ( (i % 12) == 0 ) { printf("\t"); }
+
+		printf("%d", offset);
+
+		if ( i < MAXPRIMEINDEX ) {
+
+			unsigned int phi = primes[i] - 1;
+			unsigned int d;
+
+			for (d = phi; d > 0; d--) {
+				if ( (phi % d) == 0) { offset++; }
+			}
+		}
 	}
 
 	printf("\n};\n");
@@ -942,3 +1260,94 @@ void print_phi_divisors()
 	return;
 }
 
+
+void print_disc_factors()
+{
+	unsigned int i, j;
+	unsigned int offset = 0;
+	unsigned int offsets[MAXPRIMEINDEX+1];
+	unsigned char cofactors[MAXPRIMEINDEX];
+	mpz_t cofactor;
+
+	mpz_init(cofactor);
+
+	/* for all small primes */
+	printf("unsigned int disc_factors[DISCFACTORSTOTAL] = {\n");
+	for (i = 0; i < MAXPRIMEINDEX; i++) {
+
+		unsigned int l = primes[i];
+		unsigned long k, p;
+
+		offsets[i] = offset;
+
+		mpz_set(cofactor, table_discriminant(i));
+
+		printf("\t/* %d */", l);
+
+		/*
+		 * the prime factors of the norm of Phi_l(2i) are 1 mod l (split in Z[i]) or
+		 * -1 mod l (inert), so only p = kl +- 1 are tried
+		 */
+		for (k = 2; k * l - 1 < DISCFACTORBOUND; k += 2) {
+
+			for (j = 0; j < 2; j++) {
+
+				p = j ? k * l + 1 : k * l - 1;
+
+				if (p >= DISCFACTORBOUND || mpz_fdiv_ui(cofactor, p) != 0) { continue; }
+
+				while (mpz_fdiv_ui(cofactor, p) == 0) {
+					mpz_divexact_ui(cofactor, cofactor, p);
+				}
+
+				printf(" %lu,", p);
+				offset++;
+			}
+
+			/* the cofactor is 1 or prime */
+			if (mpz_cmp_ui(cofactor, (k * l + 1) * (k * l + 1)) < 0) { break; }
+		}
+
+		if (mpz_cmp_ui(cofactor, 1) == 0) {
+			cofactors[i] = DISC_COFACTOR_ONE;
+		} else if (mpz_probab_prime_p(cofactor, 50)) {
+			cofactors[i] = DISC_COFACTOR_PRIME;
+		} else {
+			cofactors[i] = DISC_COFACTOR_COMPOSITE;
+		}
+
+		printf("\n");
+	}
+
+	offsets[MAXPRIMEINDEX] = offset;
+
+	printf("};\n\n");
+
+	/* offsets of each list, the last one is DISCFACTORSTOTAL */
+	printf("unsigned int disc_factors_offset[MAXPRIMEINDEX+1] = {\n");
+	for (i = 0; i <= MAXPRIMEINDEX; i++) {
+
+		if ( i > 0 ) { printf( (i % 12) ? ", " : ",\n"); }
+		if ( (i % 12) == 0 ) { printf("\t"); }
+
+		printf("%d", offsets[i]);
+	}
+
+	printf("\n};\n\n");
+
+	printf("unsigned char disc_cofactors[MAXPRIMEINDEX] = {\n");
+	for (i = 0; i < MAXPRIMEINDEX; i++) {
+
+		if ( i > 0 ) { printf( (i % 30) ? ", " : ",\n"); }
+		if ( (i % 30) == 0 ) { printf("\t"); }
+
+		printf("%d", cofactors[i]);
+	}
+
+	printf("\n};\n");
+
+	/* free mem */
+	mpz_clear(cofactor);
+
+	return;
+}